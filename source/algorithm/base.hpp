@@ -2,17 +2,128 @@
 
 // standard
 #include <vector>
+#include <atomic>
+#include <chrono>
+#include <functional>
 
 // internal
 #include "core.hpp"
+#include "./hull_query.hpp"
 
 namespace quick_hull 
 {
+	// Frames with fewer points are not checked against the deadline (their work is shorter than reading the clock pays off)
+	static const int control_check_point_count = 256;
+
+
+	// Cancellation token, deadline and progress of a run (shared with the thread, which cancels it).
+	// Engines check it at grow frame boundaries, a stopped run returns the hull vertices found so far:
+	// a convex polygon of true hull vertices in the hull order (a subset of the full hull).
+	struct Run_Control
+	{
+		private: // fields
+			std::atomic<bool>                     is_stopped;          // ..latched by cancelling or by the deadline
+			std::atomic<bool>                     is_deadline_reached;
+			bool                                  has_deadline;
+			std::chrono::steady_clock::time_point deadline;
+			long long                             point_count;
+			std::atomic<long long>                classified_count;    // ..points discarded inside the hull or found as vertices
+			std::atomic<int>                      reported_percent;
+			std::function<void(double)>           progress_callback;
+			std::function<void()>                 yield_callback;
+
+		public: // constructors
+			Run_Control() : is_stopped(false), is_deadline_reached(false), has_deadline(false), point_count(0), classified_count(0), reported_percent(0) { }
+
+		public: // getters
+			bool was_stopped() const { return is_stopped.load(std::memory_order_relaxed); }
+			bool was_deadline_reached() const { return is_deadline_reached.load(std::memory_order_relaxed); }
+
+		public: // setters (before the run)
+			// Stops the run after the milliseconds from now
+			void set_deadline(double milliseconds)
+			{
+				has_deadline = true;
+				deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double, std::milli>(milliseconds));
+			}
+
+			// The callback gets the fraction of classified points at each whole percent (from any thread of the run)
+			void set_progress_callback(std::function<void(double)> callback) { progress_callback = callback; }
+
+			// The callback is called at each check point before the stop is checked (from the thread of the run),
+			// so the owner can run more urgent work between grow frames
+			void set_yield_callback(std::function<void()> callback) { yield_callback = callback; }
+
+		public: // methods
+			// Lock-free, so it can be called by another thread or by a signal handler
+			void cancel() { is_stopped.store(true, std::memory_order_relaxed); }
+
+			// Returns true when the run should stop (reads the clock only when there is a deadline)
+			bool should_stop()
+			{
+				if (yield_callback) yield_callback();
+
+				if (is_stopped.load(std::memory_order_relaxed)) return true;
+
+				if (has_deadline && std::chrono::steady_clock::now() >= deadline) 
+				{
+					is_deadline_reached.store(true, std::memory_order_relaxed);
+					is_stopped.store(true, std::memory_order_relaxed);
+					return true;
+				}
+
+				return false;
+			}
+
+			// Called by engines at the start and at the end of the run
+			void begin(long long point_count)
+			{
+				this->point_count = point_count;
+				classified_count = 0;
+				reported_percent = 0;
+			}
+
+			void end()
+			{
+				if (!was_stopped()) add_classified(point_count - classified_count.load());
+			}
+
+			// Records classified points, only one thread reports each percent
+			void add_classified(long long count)
+			{
+				if (!progress_callback || point_count <= 0 || count <= 0) return;
+
+				long long classified = classified_count.fetch_add(count, std::memory_order_relaxed) + count;
+				int percent = (int)(classified * 100 / point_count);
+				int reported = reported_percent.load(std::memory_order_relaxed);
+
+				while (percent > reported) 
+				{
+					if (reported_percent.compare_exchange_weak(reported, percent)) 
+					{
+						progress_callback((double)classified / point_count);
+						break;
+					}
+				}
+			}
+	};
+
+
 	struct Algorithm 
 	{
+		protected: // fields
+			Run_Control * control = nullptr; // ..optional
+			Hull_Query    query;             // ..the full hull by default
+
+		public: // setters
+			// The control is used by following runs (until it is reset by nullptr)
+			virtual void set_control(Run_Control * control) { this->control = control; }
+			// Following runs return only the asked part of the hull
+			virtual void set_query(const Hull_Query & query) { this->query = query; }
+
 		public: // methods
 			virtual ~Algorithm() = 0;
 			// Returns a convex hull for the given set of points
-			virtual std::vector<Vector2> * run(const std::vector<Vector2> &points) = 0;
+			virtual std::vector<Vector2> * run(const Point_Buffer &points) = 0;
 	};
 }
\ No newline at end of file
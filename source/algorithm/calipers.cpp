@@ -0,0 +1,126 @@
+// standard
+#include <cmath>
+#include <algorithm>
+
+// internal
+#include "algorithm/calipers.hpp"
+
+namespace quick_hull
+{
+	static inline Vector2 scale(const Vector2 & vector, double factor)
+	{
+		return Vector2(vector.x * factor, vector.y * factor);
+	}
+
+	// Rectangle with the side on the line through the origin in the U direction, the N direction is its inner normal
+	static Hull_Rectangle make_rectangle(Vector2 origin, Vector2 u, Vector2 n, double u_min, double u_max, double height)
+	{
+		Hull_Rectangle rectangle;
+
+		rectangle.corners[0] = origin + scale(u, u_min);
+		rectangle.corners[1] = origin + scale(u, u_max);
+		rectangle.corners[2] = rectangle.corners[1] + scale(n, height);
+		rectangle.corners[3] = rectangle.corners[0] + scale(n, height);
+		rectangle.area       = (u_max - u_min) * height;
+		rectangle.perimeter  = 2 * ((u_max - u_min) + height);
+
+		return rectangle;
+	}
+
+	static inline void update_diameter(Hull_Measures & measures, const Vector2 & a, const Vector2 & b)
+	{
+		double sqr_distance = Vector2::sqr_distance(a, b);
+
+		if (sqr_distance > measures.diameter * measures.diameter)
+		{
+			measures.diameter   = std::sqrt(sqr_distance);
+			measures.diameter_a = a;
+			measures.diameter_b = b;
+		}
+	}
+
+
+	Hull_Measures measure_convex_hull(const std::vector<Vector2> & convex_hull)
+	{
+		Hull_Measures measures;
+
+		measures.diameter   = 0;
+		measures.diameter_a = Vector2(0, 0);
+		measures.diameter_b = Vector2(0, 0);
+		measures.width      = 0;
+		measures.min_area_rectangle = make_rectangle(Vector2(0, 0), Vector2(1, 0), Vector2(0, 1), 0, 0, 0);
+
+		// ..repeated vertices (e.g. a hull of equal points) would give edges without a direction
+		std::vector<Vector2> vertices;
+		vertices.reserve(convex_hull.size());
+
+		for (const auto & vertex : convex_hull)
+		{
+			if (vertices.empty() || vertex != vertices.back()) vertices.push_back(vertex);
+		}
+
+		while (vertices.size() > 1 && vertices.front() == vertices.back()) vertices.pop_back();
+
+		int count = vertices.size();
+
+		if (count > 0 && count < 3)
+		{
+			const auto & a = vertices.front();
+			const auto & b = vertices.back();
+
+			Vector2 u = count == 2 ? (b - a).get_normalized() : Vector2(1, 0);
+
+			update_diameter(measures, a, b);
+			measures.diameter_a = a;
+			measures.diameter_b = b;
+			measures.min_area_rectangle = make_rectangle(a, u, u.get_conter_clockwise_normal(), 0, measures.diameter, 0);
+		}
+
+		if (count < 3)
+		{
+			measures.min_perimeter_rectangle = measures.min_area_rectangle;
+			return measures;
+		}
+
+		// Calipers: for each edge the most right (along the edge), the top (along the inner normal) and the most left vertex,
+		// each one only moves forward, so all of them go around the hull once
+		int right = 0, top = 0, left = 0;
+
+		auto successor = [count](int vertex) { return (vertex + 1) % count; };
+
+		for (int index = 0; index < count; index++)
+		{
+			const auto & origin = vertices[index];
+			const auto & next   = vertices[successor(index)];
+
+			Vector2 u = (next - origin).get_normalized();
+			Vector2 n = u.get_conter_clockwise_normal(); // ..inner for the counter-clockwise hull
+
+			while (Vector2::dot_product(vertices[successor(right)] - vertices[right], u) > 0) right = successor(right);
+			if (index == 0) top = right;
+
+			while (Vector2::dot_product(vertices[successor(top)] - vertices[top], n) > 0) top = successor(top);
+			if (index == 0) left = top;
+
+			while (Vector2::dot_product(vertices[successor(left)] - vertices[left], u) < 0) left = successor(left);
+
+			double u_max  = Vector2::dot_product(vertices[right] - origin, u);
+			double u_min  = Vector2::dot_product(vertices[left] - origin, u);
+			double height = Vector2::dot_product(vertices[top] - origin, n);
+
+			// Diameter: the top vertex is antipodal to both ends of the edge (its successor too, when its edge is parallel)
+			update_diameter(measures, origin, vertices[top]);
+			update_diameter(measures, next, vertices[top]);
+			update_diameter(measures, origin, vertices[successor(top)]);
+			update_diameter(measures, next, vertices[successor(top)]);
+
+			Hull_Rectangle rectangle = make_rectangle(origin, u, n, u_min, u_max, height);
+
+			if (index == 0 || height < measures.width) measures.width = height;
+			if (index == 0 || rectangle.area < measures.min_area_rectangle.area) measures.min_area_rectangle = rectangle;
+			if (index == 0 || rectangle.perimeter < measures.min_perimeter_rectangle.perimeter) measures.min_perimeter_rectangle = rectangle;
+		}
+
+		return measures;
+	}
+}
\ No newline at end of file
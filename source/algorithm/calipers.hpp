@@ -0,0 +1,37 @@
+#pragma once
+
+// standard
+#include <vector>
+
+// internal
+#include "core.hpp"
+
+namespace quick_hull
+{
+	// Rectangle enclosing the hull with a side flush to a hull edge
+	struct Hull_Rectangle
+	{
+		public: // fields
+			Vector2 corners[4]; // ..counter-clockwise, the first side lies on the hull edge
+			double  area;
+			double  perimeter;
+	};
+
+
+	// Measures of a convex hull found by rotating calipers
+	struct Hull_Measures
+	{
+		public: // fields
+			double         diameter;                // ..the largest distance between two hull vertices
+			Vector2        diameter_a;
+			Vector2        diameter_b;
+			double         width;                   // ..the smallest distance between two parallel supporting lines
+			Hull_Rectangle min_area_rectangle;
+			Hull_Rectangle min_perimeter_rectangle;
+	};
+
+	// Measures the counter-clockwise convex hull in O(h): calipers rotate over its edges,
+	// both rectangles and the width have a side flush to an edge and the diameter is between antipodal vertices
+	// (a hull of one or two points gives zero width and area)
+	extern Hull_Measures measure_convex_hull(const std::vector<Vector2> & convex_hull);
+}
\ No newline at end of file
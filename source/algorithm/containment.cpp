@@ -0,0 +1,182 @@
+// standard
+#include <algorithm>
+
+// external
+#include "omp.h"
+
+// internal
+#include "predicates.hpp"
+#include "algorithm/kernels.hpp"
+#include "algorithm/containment.hpp"
+
+namespace quick_hull
+{
+	Hull_Containment::Hull_Containment(const std::vector<Vector2> & convex_hull) : vertices(convex_hull), center(0, 0)
+	{
+		int count = vertices.size();
+
+		if (count < 3) return;
+
+		center = (vertices[0] + vertices[count / 3] + vertices[2 * count / 3]) / 3;
+
+		// Starts at the smallest pseudo-angle, so the angles increase around the hull
+		std::vector<double> angles(count);
+
+		for (int index = 0; index < count; index++)
+		{
+			angles[index] = get_pseudo_angle(vertices[index].x - center.x, vertices[index].y - center.y);
+		}
+
+		int first = std::min_element(angles.begin(), angles.end()) - angles.begin();
+
+		std::rotate(vertices.begin(), vertices.begin() + first, vertices.end());
+		std::rotate(angles.begin(), angles.begin() + first, angles.end());
+
+		vertex_angles = angles;
+
+		int search_size = 1;
+		while (search_size < count) search_size *= 2;
+
+		vertex_angles.resize(search_size, 8);
+
+		for (int index = 0; index <= count; index++)
+		{
+			const auto & vertex = vertices[index % count];
+			const auto & next   = vertices[(index + 1) % count];
+
+			vertex_x.push_back(vertex.x);
+			vertex_y.push_back(vertex.y);
+
+			if (index < count)
+			{
+				edge_delta_x.push_back(next.x - vertex.x);
+				edge_delta_y.push_back(next.y - vertex.y);
+			}
+		}
+	}
+
+
+	int Hull_Containment::find_wedge(const Vector2 & point) const
+	{
+		int count = vertices.size();
+		double angle = get_pseudo_angle(point.x - center.x, point.y - center.y);
+
+		int wedge = std::upper_bound(vertex_angles.begin(), vertex_angles.begin() + count, angle) - vertex_angles.begin() - 1;
+		if (wedge < 0) wedge = count - 1; // ..before the first vertex (or the center itself)
+
+		// ..the rounded pseudo-angle is corrected by the exact sides of the wedge rays
+		for (int step = 0; step < count; step++)
+		{
+			if (predicates::orientation(center, vertices[wedge], point) < 0) wedge = (wedge + count - 1) % count;
+			else
+			if (predicates::orientation(center, vertices[(wedge + 1) % count], point) > 0) wedge = (wedge + 1) % count;
+			else break;
+		}
+
+		return wedge;
+	}
+
+	bool Hull_Containment::contains(const Vector2 & point) const
+	{
+		int count = vertices.size();
+
+		if (count == 0) return false;
+		if (count == 1) return point == vertices[0];
+
+		if (count == 2)
+		{
+			const auto & a = vertices[0];
+			const auto & b = vertices[1];
+
+			return predicates::orientation(a, b, point) == 0
+				&& point.x >= std::min(a.x, b.x) && point.x <= std::max(a.x, b.x)
+				&& point.y >= std::min(a.y, b.y) && point.y <= std::max(a.y, b.y);
+		}
+
+		int wedge = find_wedge(point);
+
+		return predicates::orientation(vertices[wedge], vertices[(wedge + 1) % count], point) >= 0;
+	}
+
+
+	void Hull_Containment::classify(const Vector2 * points, int count, unsigned char * is_inside) const
+	{
+		int vertex_count = vertices.size();
+
+		if (vertex_count < 3)
+		{
+			for (int index = 0; index < count; index++) is_inside[index] = contains(points[index]);
+			return;
+		}
+
+		const auto & kernels = get_kernels();
+
+		for (int start = 0; start < count; start += kernel_block_size)
+		{
+			int block_count = std::min(kernel_block_size, count - start);
+
+			if (vertex_count <= containment_brute_force_hull_size)
+			{
+				kernels.classify_inside_polygon
+				(
+					points + start, block_count,
+					vertex_x.data(), vertex_y.data(), edge_delta_x.data(), edge_delta_y.data(), vertex_count,
+					is_inside + start
+				);
+			}
+			else
+			{
+				kernels.classify_inside_polygon_angular
+				(
+					points + start, block_count,
+					center, vertex_x.data(), vertex_y.data(), vertex_angles.data(), vertex_angles.size(), vertex_count,
+					is_inside + start
+				);
+			}
+
+			// Uncertain points (near an edge or a wedge ray) are decided exactly
+			for (int index = start; index < start + block_count; index++)
+			{
+				if (is_inside[index] == 2) is_inside[index] = contains(points[index]);
+			}
+		}
+	}
+
+	long long Hull_Containment::count_inside(const Vector2 * points, long long count) const
+	{
+		long long inside_count = 0;
+		unsigned char is_inside[kernel_block_size];
+
+		for (long long start = 0; start < count; start += kernel_block_size)
+		{
+			int block_count = (int)std::min((long long)kernel_block_size, count - start);
+
+			classify(points + start, block_count, is_inside);
+
+			for (int index = 0; index < block_count; index++) inside_count += is_inside[index];
+		}
+
+		return inside_count;
+	}
+
+	long long Hull_Containment::classify_parallel(const Vector2 * points, long long count, unsigned char * is_inside, int thread_count) const
+	{
+		long long inside_count = 0;
+		long long block_count = (count + kernel_block_size - 1) / kernel_block_size;
+
+		if (thread_count <= 0) thread_count = omp_get_max_threads();
+
+		#pragma omp parallel for schedule(static) num_threads(thread_count) reduction(+:inside_count)
+		for (long long block = 0; block < block_count; block++)
+		{
+			long long start = block * kernel_block_size;
+			int size = (int)std::min((long long)kernel_block_size, count - start);
+
+			classify(points + start, size, is_inside + start);
+
+			for (int index = 0; index < size; index++) inside_count += is_inside[start + index];
+		}
+
+		return inside_count;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+#pragma once
+
+// standard
+#include <vector>
+
+// internal
+#include "core.hpp"
+
+namespace quick_hull
+{
+	// Hulls up to this size are queried against all edges (SIMD over the points), larger ones by the angular search
+	static const int containment_brute_force_hull_size = 8;
+
+
+	// Point-in-hull queries against a precomputed hull (the output of any engine), built once and shared by threads.
+	// Each point is found in its wedge around an interior center by binary search of the vertex pseudo-angles in O(log h),
+	// then tested against the wedge's edge. The batch paths test blocks of points by the SIMD kernels,
+	// filtered orientations decide most points and the uncertain ones are decided exactly.
+	struct Hull_Containment
+	{
+		private: // ..fields
+			std::vector<Vector2> vertices;      // ..counter-clockwise, from the smallest pseudo-angle around the center
+			std::vector<double>  vertex_x;      // ..structure of arrays with the first vertex repeated after the last one
+			std::vector<double>  vertex_y;
+			std::vector<double>  vertex_angles; // ..increasing, padded to a power of two by values above 4 (for the batch search)
+			std::vector<double>  edge_delta_x;
+			std::vector<double>  edge_delta_y;
+			Vector2              center;        // ..the centroid of three vertices (strictly inside)
+
+		public: // ..getters
+			int get_vertex_count() const { return vertices.size(); }
+
+		public: // constructors
+			// The hull is a strictly convex counter-clockwise polygon, one or two vertices make a point or a segment
+			Hull_Containment(const std::vector<Vector2> & convex_hull);
+
+		public: // methods
+			// Returns true when the point is inside the hull or on its boundary (exactly)
+			bool contains(const Vector2 & point) const;
+
+			// Writes 1 for points inside the hull or on its boundary, 0 for the others
+			void classify(const Vector2 * points, int count, unsigned char * is_inside) const;
+
+			// Returns the count of points inside the hull or on its boundary (classified in blocks on the stack)
+			long long count_inside(const Vector2 * points, long long count) const;
+
+			// Classifies the points by the threads (0: the Open MP default), returns the count of inside ones
+			long long classify_parallel(const Vector2 * points, long long count, unsigned char * is_inside, int thread_count = 0) const;
+
+		private: // methods
+			// Returns the wedge (between the vertex and the next one) containing the point, exactly
+			int find_wedge(const Vector2 & point) const;
+	};
+}
\ No newline at end of file
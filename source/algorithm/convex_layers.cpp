@@ -0,0 +1,247 @@
+// standard
+#include <algorithm>
+
+// external
+#include "omp.h"
+
+// internal
+#include "predicates.hpp"
+#include "algorithm/convex_layers.hpp"
+
+namespace quick_hull 
+{
+	// Smaller sets are peeled without certificates (all points are processed by each layer)
+	static const int certificate_min_point_count = 4096;
+
+	// The sample of the certificates takes every such point
+	static const int certificate_sample_stride = 8;
+
+
+	// Returns true when the point is strictly inside the counter-clockwise convex polygon (in O(log h) by its wedge around the first vertex)
+	static inline bool is_strictly_inside_convex_polygon(const Vector2 * polygon, int count, const Vector2 & point)
+	{
+		if (count < 3) return false;
+
+		const auto & origin = polygon[0];
+
+		if (predicates::orientation(origin, polygon[1], point) <= 0) return false;
+		if (predicates::orientation(origin, polygon[count - 1], point) >= 0) return false;
+
+		int low = 1, high = count - 1;
+
+		while (high - low > 1)
+		{
+			int middle = (low + high) / 2;
+
+			if (predicates::orientation(origin, polygon[middle], point) >= 0) low = middle;
+			else high = middle;
+		}
+
+		return predicates::orientation(polygon[low], polygon[low + 1], point) > 0;
+	}
+
+	// Lexicographic order of points (to find the active point of each layer vertex)
+	static inline bool is_before(const Vector2 & a, const Vector2 & b)
+	{
+		return a.x < b.x || (a.x == b.x && a.y < b.y);
+	}
+
+
+	Algorithm_Convex_Layers::~Algorithm_Convex_Layers() { }
+
+	Algorithm_Convex_Layers::Algorithm_Convex_Layers(int thread_count) 
+	{
+		this->thread_count = thread_count;
+		this->processed_point_count = 0;
+		this->certificate_count = 0;
+	}
+
+
+	std::vector<Vector2> * Algorithm_Convex_Layers::run(const Point_Buffer &points)
+	{
+		return layer_algorithm.run(points);
+	}
+
+	void Algorithm_Convex_Layers::compute_layers(const Point_Buffer &points, Convex_Layers &result)
+	{
+		// Resets analytic data
+		this->processed_point_count = 0;
+		this->certificate_count = 0;
+
+		if (control != nullptr) control->begin(points.size());
+
+		std::vector<int> indices;
+		peel(points, true, result, indices);
+
+		if (control != nullptr) control->end();
+	}
+
+
+	void Algorithm_Convex_Layers::peel
+	(
+		const Point_Buffer &points, 
+		bool is_top_level, 
+		Convex_Layers &result, 
+		std::vector<int> &result_indices
+	)
+	{
+		result.clear();
+		result_indices.clear();
+
+		int point_count = points.size();
+
+		// 1. Computes certificates: layers of the sample, their vertex indices are mapped to the points
+		Convex_Layers    certificates;
+		std::vector<int> certificate_indices;
+
+		certificates.clear();
+
+		if (point_count >= certificate_min_point_count) 
+		{
+			Point_Buffer sample;
+			sample.reserve(point_count / certificate_sample_stride + 1);
+
+			for (int index = 0; index < point_count; index += certificate_sample_stride) sample.push_back(points[index]);
+
+			peel(sample, false, certificates, certificate_indices);
+
+			for (auto & index : certificate_indices) index *= certificate_sample_stride;
+		}
+
+		int layer_certificate_count = certificates.get_layer_count();
+		if (is_top_level) this->certificate_count = layer_certificate_count;
+
+		// 2. Classifies points into bands: the band is the count of certificates, which strictly contain the point 
+		// (they are nested, so it is found by binary search)
+		std::vector<int> bands(point_count, 0);
+
+		if (layer_certificate_count > 0) 
+		{
+			int thread_count = this->thread_count > 0 ? this->thread_count : omp_get_max_threads();
+
+			#pragma omp parallel for schedule(static) num_threads(thread_count)
+			for (int index = 0; index < point_count; index++)
+			{
+				int low = 0, high = layer_certificate_count;
+
+				while (low < high)
+				{
+					int middle = (low + high + 1) / 2;
+					int offset = certificates.offsets[middle - 1];
+
+					if (is_strictly_inside_convex_polygon(certificates.vertices.data() + offset, certificates.offsets[middle] - offset, points[index])) low = middle;
+					else high = middle - 1;
+				}
+
+				bands[index] = low;
+			}
+		}
+
+		// ..points are ordered by their bands (counting sort)
+		std::vector<int> band_offsets(layer_certificate_count + 2, 0);
+		std::vector<int> band_points(point_count);
+
+		for (auto band : bands) band_offsets[band + 1]++;
+		for (int band = 0; band <= layer_certificate_count; band++) band_offsets[band + 1] += band_offsets[band];
+
+		{
+			auto cursors = band_offsets;
+			for (int index = 0; index < point_count; index++) band_points[cursors[bands[index]]++] = index;
+		}
+
+		// 3. Peels layers of the active points: the bands outside of the current certificate.
+		// Points inside it are inside the hull of its vertices (which are active), so they are not on the layer.
+		Point_Buffer      active_points;
+		std::vector<int>  active_indices;
+		std::vector<char> is_peeled(point_count, 0);
+		int               certificate = 0; // ..bands up to it are active
+
+		auto activate_band = [&](int band) 
+		{
+			for (int position = band_offsets[band]; position < band_offsets[band + 1]; position++) 
+			{
+				active_points.push_back(points[band_points[position]]);
+				active_indices.push_back(band_points[position]);
+			}
+		};
+
+		activate_band(0);
+
+		std::vector<std::pair<Vector2, int>> sorted_vertices;
+		std::vector<int>                     vertex_sources;
+
+		while (true)
+		{
+			// ..a certificate with a peeled vertex no longer covers its band
+			while (certificate < layer_certificate_count) 
+			{
+				bool is_whole = !active_points.empty();
+
+				for (int position = certificates.offsets[certificate]; position < certificates.offsets[certificate + 1] && is_whole; position++) 
+				{
+					is_whole = !is_peeled[certificate_indices[position]];
+				}
+
+				if (is_whole) break;
+
+				certificate++;
+				activate_band(certificate);
+			}
+
+			if (active_points.empty()) break;
+			if (is_top_level && control != nullptr && control->should_stop()) break;
+
+			if (is_top_level) this->processed_point_count += active_points.size();
+
+			auto * layer = layer_algorithm.run(active_points);
+
+			// ..the hull of equal points repeats the point
+			layer->erase(std::unique(layer->begin(), layer->end()), layer->end());
+			if (layer->size() > 1 && layer->front() == layer->back()) layer->pop_back();
+
+			// Finds an active point of each vertex (one of equal points is peeled per layer) and removes them from the active points
+			sorted_vertices.clear();
+			for (int vertex = 0; vertex < layer->size(); vertex++) sorted_vertices.push_back(std::make_pair((*layer)[vertex], vertex));
+
+			std::sort(sorted_vertices.begin(), sorted_vertices.end(), [](const std::pair<Vector2, int> & a, const std::pair<Vector2, int> & b) 
+			{
+				return is_before(a.first, b.first);
+			});
+
+			vertex_sources.assign(layer->size(), -1);
+			int kept_count = 0;
+
+			for (int position = 0; position < active_points.size(); position++)
+			{
+				const Vector2 point = active_points[position];
+
+				auto found = std::lower_bound(sorted_vertices.begin(), sorted_vertices.end(), point, [](const std::pair<Vector2, int> & vertex, const Vector2 & point) 
+				{
+					return is_before(vertex.first, point);
+				});
+
+				if (found != sorted_vertices.end() && found->first == point && vertex_sources[found->second] < 0) 
+				{
+					vertex_sources[found->second] = active_indices[position];
+					is_peeled[active_indices[position]] = 1;
+					continue;
+				}
+
+				active_points[kept_count] = point;
+				active_indices[kept_count] = active_indices[position];
+				kept_count++;
+			}
+
+			active_points.resize(kept_count);
+			active_indices.resize(kept_count);
+
+			result.vertices.insert(result.vertices.end(), layer->begin(), layer->end());
+			result.offsets.push_back(result.vertices.size());
+			result_indices.insert(result_indices.end(), vertex_sources.begin(), vertex_sources.end());
+
+			if (is_top_level && control != nullptr) control->add_classified(layer->size());
+
+			delete layer;
+		}
+	}
+}
\ No newline at end of file
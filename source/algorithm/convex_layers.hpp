@@ -0,0 +1,69 @@
+#pragma once
+
+// standard
+#include <vector>
+
+// internal
+#include "core.hpp"
+#include "./base.hpp"
+#include "./sequential.hpp"
+
+namespace quick_hull 
+{
+	// Convex layers in a single buffer: the layer I is vertices [offsets[I], offsets[I + 1]) in the counter-clockwise order
+	struct Convex_Layers 
+	{
+		public: // fields
+			std::vector<Vector2> vertices;
+			std::vector<int>     offsets;  // ..starts by 0 and ends by the vertex count
+
+		public: // getters
+			int get_layer_count() const { return offsets.empty() ? 0 : (int)offsets.size() - 1; }
+
+		public: // methods
+			void clear() { vertices.clear(); offsets.assign(1, 0); }
+	};
+
+
+	// Peels convex layers (onion peeling) of the points.
+	// Layers of every 8th point are computed first (recursively) and used as certificates: points strictly inside a layer of the sample 
+	// cannot be on a layer, while all vertices of the sample layer remain. So only points outside of the first whole certificate 
+	// are processed by layer hulls, and the band of points inside it joins them when one of its vertices is peeled.
+	struct Algorithm_Convex_Layers : public Algorithm
+	{
+		private: // ..settings
+			int thread_count; // ..threads of the band classification (0: the Open MP default)
+
+		private: // ..analytic data
+			long long processed_point_count;  // ..summed over layer hulls
+			int       certificate_count;      // ..of the top level
+
+		private: // ..layer hulls
+			Algorithm_Sequential layer_algorithm;
+
+		public: // ..getters (analytic)
+			long long get_processed_point_count() const { return processed_point_count; }
+			int get_certificate_count() const { return certificate_count; }
+
+		public: // constructors & destructors
+			~Algorithm_Convex_Layers();
+			Algorithm_Convex_Layers(int thread_count = 0);
+
+		public: // methods
+			// Returns the outer layer (the convex hull)
+			std::vector<Vector2> * run(const Point_Buffer &points) override;
+
+			// Computes all layers, a stopped run keeps the layers peeled before the stop
+			void compute_layers(const Point_Buffer &points, Convex_Layers &result);
+
+		private: // methods
+			// Peels the points and writes the index of each layer vertex in the points
+			void peel
+			(
+				const Point_Buffer &points, 
+				bool is_top_level, 
+				Convex_Layers &result, 
+				std::vector<int> &result_indices
+			);
+	};
+}
\ No newline at end of file
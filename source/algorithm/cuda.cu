@@ -47,11 +47,6 @@ namespace quick_hull
 		return cuda_vector_make(a.x + b.x, a.y + b.y);
 	}
 
-	__device__ Vector2 cuda_vector_get_normal(const Vector2& vector) 
-	{
-		return cuda_vector_make(-vector.y, vector.x);
-	}
-
 	__device__ double cuda_vector_get_sqr_magnitude(const Vector2& vector) 
 	{
 		return (vector.x * vector.x) + (vector.y * vector.y);
@@ -62,21 +57,11 @@ namespace quick_hull
 		return (vector_a.x * vector_b.x) + (vector_a.y * vector_b.y); 
 	}
 
-	__device__ Vector2 cuda_vector_project(const Vector2 &vector_a, const Vector2 &vector_b)
+	// Returns twice the area of the ABC triangle: negative when the point C is on the right side of the AB line.
+	// Division-free, but (unlike the host predicate) without the exact fallback for nearly collinear points.
+	__device__ double cuda_vector_orientation(const Vector2 &a, const Vector2 &b, const Vector2 &c)
 	{
-		double vector_b_sqr_magnitude = cuda_vector_get_sqr_magnitude(vector_b);
-
-		if (vector_b_sqr_magnitude == 0) 
-		{
-			return cuda_vector_make(0, 0);
-		}
-		
-		double relativeness = cuda_vector_dot_product(vector_a, vector_b);
-
-		return cuda_vector_make(
-			vector_b.x * (relativeness / vector_b_sqr_magnitude), 
-			vector_b.y * (relativeness / vector_b_sqr_magnitude)
-		);
+		return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
 	}
 
 
@@ -124,38 +109,23 @@ namespace quick_hull
 		block_data[thread_id].farest_point_index = line_point_a_index;
 		block_data[thread_id].farest_point_sqr_distance = 0;
 
-		// Defines AB line and its normal towards the considered side
+		// Defines AB line
 		Vector2 line_point_a = points[line_point_a_index];
 		Vector2 line_point_b = points[line_point_b_index];
-		Vector2 line = cuda_vector_subtract(line_point_b, line_point_a);
-		Vector2 line_normal = cuda_vector_get_normal(line);
 
 		// 1. Finds the farest point from AB line
 		for(int point_index = points_start; point_index < points_end; point_index++) 
 		{
 			Vector2 point = points[point_index];
 
-			// A point, which is a base of a projection on the AB line from the current point
-			Vector2 projection_base = cuda_vector_add(
-				cuda_vector_project(
-					cuda_vector_subtract(point, line_point_a), 
-					line
-				),
-				line_point_a 
-			); 
-
-			// The projection (as vector) from the base to the point
-			Vector2 projection = cuda_vector_subtract(point, projection_base);
-
-			// Relativity checks that point is on the considered side of the AB line
-			double relativity = cuda_vector_dot_product(projection, line_normal);
-			double projection_sqr_magnitude = cuda_vector_get_sqr_magnitude(projection);
+			// Distance (scaled by the AB length) is positive when the point is on the right side of the AB line
+			double distance = -cuda_vector_orientation(line_point_a, line_point_b, point);
 
 			// Saves the farest point data
-			if (relativity > 0 && block_data[thread_id].farest_point_sqr_distance < projection_sqr_magnitude)
+			if (distance > 0 && block_data[thread_id].farest_point_sqr_distance < distance)
 			{
 				block_data[thread_id].farest_point_index = point_index;
-				block_data[thread_id].farest_point_sqr_distance = projection_sqr_magnitude;
+				block_data[thread_id].farest_point_sqr_distance = distance;
 			}
 		}
 		
@@ -201,9 +171,12 @@ namespace quick_hull
 	(
 		int point_a_index, 
 		int point_b_index, 
-		const std::vector<Vector2> & points
+		const Point_Buffer & points
 	)
 	{
+		// ..a stopped run keeps only the vertices found so far (each call scans all points, so it is checked every call)
+		if (control != nullptr && control->should_stop()) return;
+
 		// Captures kernel start time
 		auto stopwatch_start = std::chrono::steady_clock::now();
 
@@ -300,7 +273,7 @@ namespace quick_hull
 	template<int T_Block_Count, int T_Thread_Count>
 	std::vector<Vector2> * Algorithm_Cuda::internal_run
 	(
-		const std::vector<Vector2> &points
+		const Point_Buffer &points
 	)
 	{
 		int most_left_index  = 0;
@@ -318,7 +291,7 @@ namespace quick_hull
 				most_right_index = index;
 			}
 			else
-			if (point.x < most_left.x || (point.x == most_right.x && point.y < most_right.y)) 
+			if (point.x < most_left.x || (point.x == most_left.x && point.y < most_left.y)) 
 			{
 				most_left_index = index;
 			}
@@ -354,21 +327,30 @@ namespace quick_hull
 
 		convex_hull->push_back(points[most_left_index]);
 		
-		// 3.1 Grows the convex hull from ML->MR line 
-		grow<T_Block_Count, T_Thread_Count>(
-			most_left_index, 
-			most_right_index, 
-			points
-		);
+		// 3.1 Grows the convex hull from ML->MR line (sides, which the query does not ask for, are skipped)
+		if (query.has_lower_side()) 
+		{
+			grow<T_Block_Count, T_Thread_Count>(
+				most_left_index, 
+				most_right_index, 
+				points
+			);
+		}
 		
 		convex_hull->push_back(points[most_right_index]);
 		
 		// 3.2 Grows the convex hull from MR->ML line 
-		grow<T_Block_Count, T_Thread_Count>(
-			most_right_index, 
-			most_left_index,
-			points
-		);
+		if (query.has_upper_side()) 
+		{
+			grow<T_Block_Count, T_Thread_Count>(
+				most_right_index, 
+				most_left_index,
+				points
+			);
+		}
+
+		// ..subproblems are not pruned by the sector, the part is cut out of the computed sides
+		select_hull_part(*convex_hull, query);
 
 		// 4. Releases special CUDA memory
 		macro_cuda_call(cudaFreeHost(host_far_points));
@@ -388,7 +370,7 @@ namespace quick_hull
 		this->block_power = block_power;
 	}
 
-	std::vector<Vector2> * Algorithm_Cuda::run(const std::vector<Vector2> &points)
+	std::vector<Vector2> * Algorithm_Cuda::run(const Point_Buffer &points)
 	{
 		// Resets analytic data
 		this->kernel_total_time = 0;
@@ -47,7 +47,7 @@ namespace quick_hull
 			Algorithm_Cuda(int block_power);
 			
 		public: //.. methods
-			std::vector<Vector2> * run(const std::vector<Vector2> &points) override;
+			std::vector<Vector2> * run(const Point_Buffer &points) override;
 
 		private: //..methods
 
@@ -56,13 +56,13 @@ namespace quick_hull
 			(
 				int point_a_index, 
 				int point_b_index, 
-				const std::vector<Vector2> & points
+				const Point_Buffer & points
 			);
 
 			template<int T_Block_Count, int T_Thread_Count>
 			std::vector<Vector2> * internal_run
 			(
-				const std::vector<Vector2> &points
+				const Point_Buffer &points
 			);
 	};
 }
\ No newline at end of file
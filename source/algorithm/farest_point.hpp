@@ -0,0 +1,166 @@
+#pragma once
+
+// standard
+#include <cmath>
+#include <algorithm>
+
+// internal
+#include "core.hpp"
+#include "predicates.hpp"
+#include "./kernels.hpp"
+
+namespace quick_hull 
+{
+	// Finds the farest point on the right side of the AB line (the next counter-clockwise hull vertex)
+	struct Farest_Point_Search 
+	{
+		public: // fields
+			Vector2 a;
+			Vector2 b;
+			Vector2 c;             // the farest point from AB line (A while nothing is found).
+			double  distance_to_c; // the farest distance (scaled by the AB length) from the AB line to the C point.
+			double  error_of_c;    // the absolute error bound of the distance to the C point.
+
+		public: // constructors
+			Farest_Point_Search(Vector2 a, Vector2 b) : a(a), b(b), c(a), distance_to_c(0), error_of_c(0) { }
+
+		public: // methods
+			bool is_found() const { return c != a; }
+
+			// Returns true when the point E is strictly on the right side of the AB line (and keeps it when it is the farest)
+			inline bool consider(const Vector2 & e)
+			{
+				// Twice the area of the ABE triangle, negative when the point E is on the right side
+				double error;
+				double orientation = predicates::orientation_filtered(a, b, e, error);
+
+				return consider(e, orientation, error);
+			}
+
+			// Same as above for the orientation precomputed by the kernel (see Kernel_Set::compute_orientations)
+			inline bool consider(const Vector2 & e, double orientation, double error)
+			{
+				// Skips points on the left side or on the line (resolves uncertain signs exactly)
+				if (orientation >= -error && (orientation > error || predicates::orientation_exact(a, b, e) >= 0)) return false;
+
+				update(e, -orientation, error);
+
+				return true;
+			}
+
+			// Filters points on the right side of the AB line into the output (with space for all points), returns their count.
+			// Orientations are computed in blocks by the vectorized kernel, points are stored without branching on their side.
+			inline int filter(const Vector2 * points, int count, Vector2 * output)
+			{
+				const auto & kernels = get_kernels();
+				double orientations[kernel_block_size];
+				double errors[kernel_block_size];
+				int output_count = 0;
+
+				for (int start = 0; start < count; start += kernel_block_size)
+				{
+					int block_count = std::min(kernel_block_size, count - start);
+
+					kernels.compute_orientations(a, b, points + start, block_count, orientations, errors);
+
+					for (int index = 0; index < block_count; index++)
+					{
+						const Vector2 & e = points[start + index];
+						double orientation = orientations[index];
+						double error = errors[index];
+
+						// ..nearly collinear points take the exact path
+						if (std::fabs(orientation) <= error)
+						{
+							if (consider(e, orientation, error)) output[output_count++] = e;
+							continue;
+						}
+
+						output[output_count] = e;
+						output_count += orientation < 0;
+
+						// ..points on the left side never pass the distance check
+						update(e, -orientation, error);
+					}
+				}
+
+				return output_count;
+			}
+
+			// Keeps the farest point of the other search over the same AB line (e.g. run by another thread)
+			inline void merge(const Farest_Point_Search & other)
+			{
+				if (other.is_found()) update(other.c, other.distance_to_c, other.error_of_c);
+			}
+
+		private: // methods
+			// Keeps the point (strictly on the right side) when it is the farest
+			inline void update(const Vector2 & e, double distance, double error)
+			{
+				// Only the exactly farest point is a convex hull vertex, so uncertain comparisons are resolved exactly
+				if (distance + error >= distance_to_c - error_of_c)
+				{
+					if (distance - error > distance_to_c + error_of_c || predicates::is_further_exact(a, b, e, c))
+					{
+						c = e;
+						distance_to_c = distance;
+						error_of_c = error;
+					}
+				}
+			}
+	};
+
+
+	// Pending subproblem of the iterative [ grow ]: points [begin, end) lay on the right side of the AB line and C is the farest of them.
+	// A frame with an empty range only emits its A point as a convex hull vertex.
+	struct Grow_Frame 
+	{
+		public: // fields
+			Vector2 a;
+			Vector2 b;
+			Vector2 c;
+			int     begin;
+			int     end;
+			int     depth;
+			double  direction_begin; // ..range of the edge directions of the hull chain from A to B (set only for sector queries)
+			double  direction_end;
+	};
+
+
+	// Partitions points (all on the right side of the AB line) in place around the farest point C:
+	// [begin, left_end) are on the right side of the AC line, [right_begin, end) of the CB line, the rest is discarded.
+	inline void partition_around_farest_point
+	(
+		Vector2 * points, 
+		int       begin, 
+		int       end, 
+		Farest_Point_Search & left_search,  // ..for the AC line
+		Farest_Point_Search & right_search, // ..for the CB line
+		int     & left_end, 
+		int     & right_begin
+	)
+	{
+		left_end    = begin;
+		right_begin = end;
+
+		int index = begin;
+
+		while (index < right_begin)
+		{
+			Vector2 e = points[index];
+
+			if (left_search.consider(e)) 
+			{
+				points[index++] = points[left_end];
+				points[left_end++] = e;
+			}
+			else
+			if (right_search.consider(e))
+			{
+				points[index] = points[--right_begin];
+				points[right_begin] = e;
+			}
+			else index++;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,153 @@
+// standard
+#include <cmath>
+#include <algorithm>
+
+// internal
+#include "algorithm/hull_query.hpp"
+
+namespace quick_hull 
+{
+	static const double pi = 3.14159265358979323846;
+
+	const double Hull_Query::lower_chain_direction_begin = -pi / 2;
+	const double Hull_Query::lower_chain_direction_end   =  pi / 2;
+	const double Hull_Query::upper_chain_direction_begin =  pi / 2;
+	const double Hull_Query::upper_chain_direction_end   =  pi * 3 / 2;
+
+
+	// Returns the angle counter-clockwise from the origin angle in [0, 2pi)
+	static inline double get_angle_from(double angle, double origin)
+	{
+		double relative = std::fmod(angle - origin, 2 * pi);
+
+		return relative < 0 ? relative + 2 * pi : relative;
+	}
+
+	// Outward direction of a counter-clockwise edge (its direction turned clockwise)
+	static inline double get_outward_direction(Vector2 a, Vector2 b)
+	{
+		return std::atan2(b.y - a.y, b.x - a.x) - pi / 2;
+	}
+
+
+	bool Hull_Query::is_chain_facing(double direction_begin, double direction_end) const
+	{
+		if (part != Hull_Part::Sector) return true;
+
+		double sector_width = sector_end - sector_begin;
+		if (sector_width >= 2 * pi) return true;
+
+		// ..outward directions of the chain vertices are between its first and last edge
+		double begin = get_angle_from(direction_begin - pi / 2, sector_begin);
+
+		return begin <= sector_width || begin + (direction_end - direction_begin) >= 2 * pi;
+	}
+
+
+	double get_chain_direction(Vector2 a, Vector2 b, double direction_begin, double direction_end)
+	{
+		double direction = std::atan2(b.y - a.y, b.x - a.x);
+
+		while (direction <  direction_begin - pi) direction += 2 * pi;
+		while (direction >= direction_begin + pi) direction -= 2 * pi;
+
+		// ..rounding may put the edge slightly out of the range
+		return std::min(std::max(direction, direction_begin), direction_end);
+	}
+
+
+	void select_hull_part(std::vector<Vector2> & convex_hull, const Hull_Query & query)
+	{
+		int count = convex_hull.size();
+
+		if (query.is_all() || count < 2) return;
+
+		std::vector<char> is_kept(count, 0);
+
+		if (query.part == Hull_Part::Upper || query.part == Hull_Part::Lower) 
+		{
+			// ..same extreme points as the engines: the most left with the lowest y and the most right with the highest y
+			int most_left = 0, most_right = 0;
+
+			for (int index = 1; index < count; index++)
+			{
+				const auto & point = convex_hull[index];
+
+				if (point.x < convex_hull[most_left].x  || (point.x == convex_hull[most_left].x  && point.y < convex_hull[most_left].y))  most_left  = index;
+				if (point.x > convex_hull[most_right].x || (point.x == convex_hull[most_right].x && point.y > convex_hull[most_right].y)) most_right = index;
+			}
+
+			int first = query.part == Hull_Part::Lower ? most_left : most_right;
+			int last  = query.part == Hull_Part::Lower ? most_right : most_left;
+
+			// The chain goes from the first to the last extreme point, both are always written (as by the engines),
+			// so a degenerate hull (a point or a segment) gives the same part
+			std::vector<Vector2> part(1, convex_hull[first]);
+
+			for (int index = first; index != last;)
+			{
+				index = (index + 1) % count;
+				part.push_back(convex_hull[index]);
+			}
+
+			if (first == last) part.push_back(convex_hull[last]);
+
+			convex_hull.swap(part);
+			return;
+		}
+		else 
+		{
+			double sector_width = query.sector_end - query.sector_begin;
+			if (sector_width >= 2 * pi) return;
+
+			// Outward directions of a vertex go counter-clockwise from its incoming to its outgoing edge, 
+			// the vertex is kept, when they meet the sector (or go around its begin)
+			double incoming = get_angle_from(get_outward_direction(convex_hull[count - 1], convex_hull[0]), query.sector_begin);
+
+			for (int index = 0; index < count; index++)
+			{
+				double outgoing = get_angle_from(get_outward_direction(convex_hull[index], convex_hull[(index + 1) % count]), query.sector_begin);
+
+				is_kept[index] = incoming <= sector_width || outgoing <= sector_width || outgoing < incoming;
+				incoming = outgoing;
+			}
+		}
+
+		// Kept vertices are contiguous, the part starts after a dropped vertex
+		int first = 0;
+		for (int index = 0; index < count; index++) 
+		{
+			if (!is_kept[index] && is_kept[(index + 1) % count]) first = (index + 1) % count;
+		}
+
+		std::vector<Vector2> part;
+		for (int index = first; part.size() < count && is_kept[index]; index = (index + 1) % count) 
+		{
+			part.push_back(convex_hull[index]);
+		}
+
+		convex_hull.swap(part);
+	}
+
+
+	bool try_parse_hull_part(const std::string & text, Hull_Part & result)
+	{
+		if (text == "all")    { result = Hull_Part::All;    return true; }
+		if (text == "upper")  { result = Hull_Part::Upper;  return true; }
+		if (text == "lower")  { result = Hull_Part::Lower;  return true; }
+		if (text == "sector") { result = Hull_Part::Sector; return true; }
+
+		return false;
+	}
+
+	std::string get_hull_part_name(Hull_Part part)
+	{
+		switch (part) 
+		{
+			case Hull_Part::Upper:  return "upper";
+			case Hull_Part::Lower:  return "lower";
+			case Hull_Part::Sector: return "sector";
+			default:                return "all";
+		}
+	}
+}
\ No newline at end of file
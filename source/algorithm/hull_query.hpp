@@ -0,0 +1,64 @@
+#pragma once
+
+// standard
+#include <vector>
+#include <string>
+
+// internal
+#include "core.hpp"
+
+namespace quick_hull 
+{
+	// Part of the convex hull asked by a query
+	enum class Hull_Part 
+	{
+		All,
+		Upper,  // ..from the most right to the most left point (both included)
+		Lower,  // ..from the most left to the most right point (both included)
+		Sector  // ..vertices, which are extreme in some outward direction of the sector
+	};
+
+
+	// Engines compute only the asked part and skip subproblems, which cannot contribute to it.
+	// Parts are returned in the counter-clockwise hull order.
+	struct Hull_Query 
+	{
+		public: // fields
+			Hull_Part part;
+			double    sector_begin; // ..outward direction (radians), the sector goes counter-clockwise to its end
+			double    sector_end;
+
+		public: // constructors
+			Hull_Query() : part(Hull_Part::All), sector_begin(0), sector_end(0) { }
+			Hull_Query(Hull_Part part) : part(part), sector_begin(0), sector_end(0) { }
+			Hull_Query(double sector_begin, double sector_end) : part(Hull_Part::Sector), sector_begin(sector_begin), sector_end(sector_end) { }
+
+		public: // getters
+			bool is_all() const { return part == Hull_Part::All; }
+			bool is_sector() const { return part == Hull_Part::Sector; }
+			bool has_lower_side() const { return part != Hull_Part::Upper && (part != Hull_Part::Sector || is_chain_facing(lower_chain_direction_begin, lower_chain_direction_end)); }
+			bool has_upper_side() const { return part != Hull_Part::Lower && (part != Hull_Part::Sector || is_chain_facing(upper_chain_direction_begin, upper_chain_direction_end)); }
+
+		public: // methods
+			// Returns true when a chain with edge directions in the range (counter-clockwise) has vertices facing the sector
+			bool is_chain_facing(double direction_begin, double direction_end) const;
+
+		public: // constants
+			// Edge directions of the chains between the most left and the most right point (the hull is counter-clockwise)
+			static const double lower_chain_direction_begin;
+			static const double lower_chain_direction_end;
+			static const double upper_chain_direction_begin;
+			static const double upper_chain_direction_end;
+	};
+
+
+	// Returns the direction of the AB edge within the range of its chain (the range spans at most a half turn)
+	extern double get_chain_direction(Vector2 a, Vector2 b, double direction_begin, double direction_end);
+
+	// Cuts the asked part out of the convex hull: the full hull or the hull with subproblems skipped by the query
+	// (a skipped chain is replaced by its chord, which faces the same side of the sector)
+	extern void select_hull_part(std::vector<Vector2> & convex_hull, const Hull_Query & query);
+
+	extern bool try_parse_hull_part(const std::string & text, Hull_Part & result);
+	extern std::string get_hull_part_name(Hull_Part part);
+}
\ No newline at end of file
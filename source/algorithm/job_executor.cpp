@@ -0,0 +1,197 @@
+// standard
+#include <utility>
+#include <algorithm>
+
+// internal
+#include "algorithm/job_executor.hpp"
+
+namespace quick_hull
+{
+	static double get_milliseconds_between(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+	{
+		return std::chrono::duration<double, std::milli>(end - start).count();
+	}
+
+
+	Job_Executor::Job_Executor(int worker_count) : interactive_count(0), is_closed(false)
+	{
+		if (worker_count <= 0) worker_count = std::max(1, (int)std::thread::hardware_concurrency());
+
+		for (int index = 0; index < worker_count; index++) workers.emplace_back(&Job_Executor::work, this);
+	}
+
+	Job_Executor::~Job_Executor()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+
+			is_closed = true;
+			not_empty.notify_all();
+		}
+
+		for (auto & worker : workers) worker.join();
+	}
+
+
+	std::future<Job_Result> Job_Executor::submit(Point_Buffer points, Job_Options options)
+	{
+		std::unique_ptr<Job> job(new Job());
+
+		job->points.swap(points);
+		job->options = options;
+
+		auto future = job->promise.get_future();
+
+		push(std::move(job));
+		return future;
+	}
+
+	void Job_Executor::submit(Point_Buffer points, Job_Options options, std::function<void(Job_Result)> completion)
+	{
+		std::unique_ptr<Job> job(new Job());
+
+		job->points.swap(points);
+		job->options    = options;
+		job->completion = completion;
+
+		push(std::move(job));
+	}
+
+
+	void Job_Executor::push(std::unique_ptr<Job> job)
+	{
+		job->submit_time = std::chrono::steady_clock::now();
+
+		std::lock_guard<std::mutex> lock(mutex);
+
+		if (job->options.priority == Job_Priority::Interactive) interactive_count++;
+
+		queues[(int)job->options.priority].push_back(std::move(job));
+		not_empty.notify_one();
+	}
+
+	std::unique_ptr<Job_Executor::Job> Job_Executor::pop()
+	{
+		for (auto & queue : queues)
+		{
+			if (queue.empty()) continue;
+
+			std::unique_ptr<Job> job = std::move(queue.front());
+			queue.pop_front();
+
+			if (job->options.priority == Job_Priority::Interactive) interactive_count--;
+
+			return job;
+		}
+
+		return nullptr;
+	}
+
+	std::unique_ptr<Job_Executor::Job> Job_Executor::try_pop_interactive()
+	{
+		// ..checked without the lock on each check point of a batch job
+		if (interactive_count.load(std::memory_order_relaxed) == 0) return nullptr;
+
+		std::lock_guard<std::mutex> lock(mutex);
+
+		auto & queue = queues[(int)Job_Priority::Interactive];
+
+		if (queue.empty()) return nullptr;
+
+		std::unique_ptr<Job> job = std::move(queue.front());
+		queue.pop_front();
+
+		interactive_count--;
+		return job;
+	}
+
+
+	void Job_Executor::work()
+	{
+		// ..interactive jobs never yield, so a second instance is enough for the nested runs
+		Algorithm_Sequential algorithm;
+		Algorithm_Sequential yield_algorithm;
+
+		while (true)
+		{
+			std::unique_ptr<Job> job;
+
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+
+				not_empty.wait(lock, [this] { return is_closed || !queues[0].empty() || !queues[1].empty(); });
+
+				job = pop();
+			}
+
+			if (job == nullptr) return; // ..closed and all jobs are done
+
+			bool is_yielding = job->options.priority == Job_Priority::Batch;
+
+			run_job(*job, algorithm, is_yielding ? &yield_algorithm : nullptr);
+		}
+	}
+
+	void Job_Executor::run_job(Job & job, Algorithm_Sequential & algorithm, Algorithm_Sequential * yield_algorithm)
+	{
+		auto stopwatch_start = std::chrono::steady_clock::now();
+
+		Job_Result result;
+		Run_Control control;
+
+		result.was_stopped        = false;
+		result.error              = nullptr;
+		result.yield_count        = 0;
+		result.queue_milliseconds = get_milliseconds_between(job.submit_time, stopwatch_start);
+
+		if (job.options.deadline_milliseconds >= 0)
+		{
+			control.set_deadline(job.options.deadline_milliseconds - result.queue_milliseconds);
+		}
+
+		if (yield_algorithm != nullptr)
+		{
+			control.set_yield_callback([&]
+			{
+				while (auto interactive_job = try_pop_interactive())
+				{
+					run_job(*interactive_job, *yield_algorithm, nullptr);
+					result.yield_count++;
+				}
+			});
+		}
+
+		// ..a failed run (e.g. out of memory) is passed to the caller, it must not end the worker thread
+		try
+		{
+			if (!job.points.empty() && !control.should_stop())
+			{
+				algorithm.set_query(job.options.query);
+				algorithm.set_control(&control);
+
+				std::unique_ptr<std::vector<Vector2>> convex_hull(algorithm.run(job.points));
+				result.convex_hull.swap(*convex_hull);
+
+				algorithm.set_control(nullptr);
+			}
+		}
+		catch (...)
+		{
+			algorithm.set_control(nullptr);
+
+			result.convex_hull.clear();
+			result.error = std::current_exception();
+		}
+
+		result.was_stopped      = control.was_stopped();
+		result.run_milliseconds = get_milliseconds_between(stopwatch_start, std::chrono::steady_clock::now());
+
+		// ..the points are not needed any more (the caller may wait for the result to submit more)
+		Point_Buffer().swap(job.points);
+
+		if (job.completion) job.completion(std::move(result));
+		else 
+		if (result.error) job.promise.set_exception(result.error);
+		else job.promise.set_value(std::move(result));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,112 @@
+#pragma once
+
+// standard
+#include <mutex>
+#include <deque>
+#include <chrono>
+#include <exception>
+#include <atomic>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <functional>
+#include <condition_variable>
+
+// internal
+#include "core.hpp"
+#include "./base.hpp"
+#include "./hull_query.hpp"
+#include "./sequential.hpp"
+
+namespace quick_hull
+{
+	// Priority class of a submitted job, workers take interactive jobs first
+	enum class Job_Priority
+	{
+		Interactive, // ..latency critical, run also by batch jobs yielding between their grow frames
+		Batch
+	};
+
+	static const int job_priority_count = 2;
+
+
+	struct Job_Options
+	{
+		public: // fields
+			Job_Priority priority;
+			Hull_Query   query;
+			double       deadline_milliseconds; // ..from the submission, negative: none
+
+		public: // constructors
+			Job_Options() : priority(Job_Priority::Batch), deadline_milliseconds(-1) { }
+			Job_Options(Job_Priority priority) : priority(priority), deadline_milliseconds(-1) { }
+	};
+
+
+	struct Job_Result
+	{
+		public: // fields
+			std::vector<Vector2> convex_hull;
+			bool                 was_stopped;        // ..by the deadline, the hull holds the vertices found so far
+			double               queue_milliseconds; // ..from the submission to the start of computing
+			double               run_milliseconds;   // ..including interactive jobs run while yielding
+			int                  yield_count;        // ..interactive jobs run by this job's worker between its grow frames
+			std::exception_ptr   error;              // ..set when computing threw (the hull is empty), the future rethrows it instead
+	};
+
+
+	// Runs submitted jobs asynchronously on its own workers, each worker computes a job by the sequential engine.
+	// A batch job checks for waiting interactive jobs between its grow frames and runs them before continuing,
+	// so a small interactive job does not wait for a long batch hull even when all workers are busy.
+	struct Job_Executor
+	{
+		private: // ..types
+			struct Job
+			{
+				public: // fields
+					Point_Buffer                          points;
+					Job_Options                           options;
+					std::promise<Job_Result>              promise;
+					std::function<void(Job_Result)>       completion; // ..replaces the promise when set
+					std::chrono::steady_clock::time_point submit_time;
+			};
+
+		private: // ..fields
+			std::vector<std::thread>         workers;
+			std::deque<std::unique_ptr<Job>> queues[job_priority_count];
+			std::mutex                       mutex;
+			std::condition_variable          not_empty;
+			std::atomic<int>                 interactive_count; // ..queued interactive jobs, read by yielding jobs without the lock
+			bool                             is_closed;
+
+		public: // constructors & destructors
+			// Starts the workers (0: one per hardware thread)
+			Job_Executor(int worker_count = 0);
+			// Runs the queued jobs and stops the workers
+			~Job_Executor();
+
+			Job_Executor(const Job_Executor &) = delete;
+			Job_Executor & operator=(const Job_Executor &) = delete;
+
+		public: // getters
+			int get_worker_count() const { return workers.size(); }
+
+		public: // methods
+			// Queues the job, the future gets its result (the points are moved in, the caller does not keep them)
+			std::future<Job_Result> submit(Point_Buffer points, Job_Options options = Job_Options());
+			// Queues the job, the completion is called with its result from a worker thread (it must not throw)
+			void submit(Point_Buffer points, Job_Options options, std::function<void(Job_Result)> completion);
+
+		private: // methods
+			void push(std::unique_ptr<Job> job);
+			// Takes the first job of the most urgent non-empty class (with the lock held)
+			std::unique_ptr<Job> pop();
+			// Takes a queued interactive job, returns nullptr when there is none
+			std::unique_ptr<Job> try_pop_interactive();
+
+			void work();
+			// Computes the job by the algorithm, a batch job yields to interactive ones computed by the yield algorithm
+			void run_job(Job & job, Algorithm_Sequential & algorithm, Algorithm_Sequential * yield_algorithm);
+	};
+}
\ No newline at end of file
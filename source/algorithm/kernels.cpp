@@ -0,0 +1,319 @@
+// standard
+#include <cmath>
+
+// internal
+#include "predicates.hpp"
+#include "algorithm/kernels.hpp"
+
+// Function multiversioning is available only for x86 with GCC or Clang (other targets use the baseline loops)
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+	#define QUICK_HULL_KERNEL_DISPATCH 1
+	#define QUICK_HULL_KERNEL_BODY     static inline __attribute__((always_inline))
+	#define QUICK_HULL_KERNEL_TARGET(isa) __attribute__((target(isa)))
+#else
+	#define QUICK_HULL_KERNEL_DISPATCH 0
+	#define QUICK_HULL_KERNEL_BODY     static inline
+	#define QUICK_HULL_KERNEL_TARGET(isa)
+#endif
+
+namespace quick_hull 
+{
+	// * Kernel bodies (inlined into each instruction set variant)
+
+	QUICK_HULL_KERNEL_BODY void compute_orientations_body
+	(
+		Vector2         a, 
+		Vector2         b, 
+		const Vector2 * points, 
+		int             count, 
+		double        * orientations, 
+		double        * errors
+	)
+	{
+		const double ab_x = b.x - a.x;
+		const double ab_y = b.y - a.y;
+
+		#pragma omp simd
+		for (int index = 0; index < count; index++)
+		{
+			double left  = ab_x * (points[index].y - a.y);
+			double right = ab_y * (points[index].x - a.x);
+
+			orientations[index] = left - right;
+			errors[index] = predicates::orientation_error_bound * (std::fabs(left) + std::fabs(right));
+		}
+	}
+
+	QUICK_HULL_KERNEL_BODY void classify_inside_octagon_body
+	(
+		const float   * points_x, 
+		const float   * points_y, 
+		int             count, 
+		const float   * edge_a, 
+		const float   * edge_b, 
+		const float   * edge_c, 
+		const float   * edge_margin, 
+		unsigned char * is_inside
+	)
+	{
+		#pragma omp simd
+		for (int index = 0; index < count; index++)
+		{
+			float x = points_x[index];
+			float y = points_y[index];
+			int inside = 1;
+
+			for (int edge = 0; edge < 8; edge++)
+			{
+				inside &= edge_a[edge] * x + edge_b[edge] * y + edge_c[edge] > edge_margin[edge];
+			}
+
+			is_inside[index] = inside;
+		}
+	}
+
+
+	QUICK_HULL_KERNEL_BODY void classify_inside_polygon_body
+	(
+		const Vector2 * points, 
+		int             count, 
+		const double  * edge_start_x, 
+		const double  * edge_start_y, 
+		const double  * edge_delta_x, 
+		const double  * edge_delta_y, 
+		int             edge_count, 
+		unsigned char * classes
+	)
+	{
+		// ..edges in the outer loop, so the inner loop over the points vectorizes
+		unsigned char is_outside[kernel_block_size] = { };
+		unsigned char is_uncertain[kernel_block_size] = { };
+
+		for (int edge = 0; edge < edge_count; edge++)
+		{
+			const double start_x = edge_start_x[edge], start_y = edge_start_y[edge];
+			const double delta_x = edge_delta_x[edge], delta_y = edge_delta_y[edge];
+
+			#pragma omp simd
+			for (int index = 0; index < count; index++)
+			{
+				double left  = delta_x * (points[index].y - start_y);
+				double right = delta_y * (points[index].x - start_x);
+				double bound = predicates::orientation_error_bound * (std::fabs(left) + std::fabs(right));
+
+				is_outside[index]   |= (left - right) < -bound;
+				is_uncertain[index] |= std::fabs(left - right) <= bound;
+			}
+		}
+
+		#pragma omp simd
+		for (int index = 0; index < count; index++)
+		{
+			classes[index] = is_outside[index] ? 0 : (is_uncertain[index] ? 2 : 1);
+		}
+	}
+
+	QUICK_HULL_KERNEL_BODY void classify_inside_polygon_angular_body
+	(
+		const Vector2 * points, 
+		int             count, 
+		Vector2         center, 
+		const double  * vertex_x, 
+		const double  * vertex_y, 
+		const double  * vertex_angles, 
+		int             search_size, 
+		int             vertex_count, 
+		unsigned char * classes
+	)
+	{
+		double angles[kernel_block_size];
+		int    wedges[kernel_block_size];
+
+		#pragma omp simd
+		for (int index = 0; index < count; index++)
+		{
+			angles[index] = get_pseudo_angle(points[index].x - center.x, points[index].y - center.y);
+			wedges[index] = 0;
+		}
+
+		// Branchless search of the last vertex, which is not after the point (each step over all points),
+		// points before the first vertex are in the last wedge
+		for (int step = search_size >> 1; step > 0; step >>= 1)
+		{
+			#pragma omp simd
+			for (int index = 0; index < count; index++)
+			{
+				int next = wedges[index] + step;
+
+				wedges[index] = vertex_angles[next] <= angles[index] ? next : wedges[index];
+			}
+		}
+
+		#pragma omp simd
+		for (int index = 0; index < count; index++)
+		{
+			double x = points[index].x;
+			double y = points[index].y;
+			int wedge = vertex_angles[0] <= angles[index] ? wedges[index] : vertex_count - 1;
+
+			double a_x = vertex_x[wedge],     a_y = vertex_y[wedge];
+			double b_x = vertex_x[wedge + 1], b_y = vertex_y[wedge + 1];
+
+			// Filtered orientations of the point to the wedge rays and to the edge
+			double ray_a_left  = (a_x - center.x) * (y - center.y);
+			double ray_a_right = (a_y - center.y) * (x - center.x);
+			double ray_b_left  = (b_x - center.x) * (y - center.y);
+			double ray_b_right = (b_y - center.y) * (x - center.x);
+			double edge_left   = (b_x - a_x) * (y - a_y);
+			double edge_right  = (b_y - a_y) * (x - a_x);
+
+			double ray_a_bound = predicates::orientation_error_bound * (std::fabs(ray_a_left) + std::fabs(ray_a_right));
+			double ray_b_bound = predicates::orientation_error_bound * (std::fabs(ray_b_left) + std::fabs(ray_b_right));
+			double edge_bound  = predicates::orientation_error_bound * (std::fabs(edge_left) + std::fabs(edge_right));
+
+			// ..the pseudo-angle is rounded, so only points surely inside the wedge are classified by its edge
+			int is_in_wedge  = ((ray_a_left - ray_a_right) > ray_a_bound) & ((ray_b_left - ray_b_right) < -ray_b_bound);
+			int is_inner     = (edge_left - edge_right) > edge_bound;
+			int is_outer     = (edge_left - edge_right) < -edge_bound;
+
+			classes[index] = 2 - is_in_wedge * (is_inner + 2 * is_outer);
+		}
+	}
+
+
+	// * Instruction set variants
+
+	#define QUICK_HULL_DEFINE_KERNELS(suffix, isa)                                                    \
+		QUICK_HULL_KERNEL_TARGET(isa) static void compute_orientations_##suffix                      \
+		(Vector2 a, Vector2 b, const Vector2 * points, int count, double * orientations, double * errors) \
+		{                                                                                            \
+			compute_orientations_body(a, b, points, count, orientations, errors);                    \
+		}                                                                                            \
+		QUICK_HULL_KERNEL_TARGET(isa) static void classify_inside_octagon_##suffix                   \
+		(const float * points_x, const float * points_y, int count, const float * edge_a,            \
+		 const float * edge_b, const float * edge_c, const float * edge_margin, unsigned char * is_inside) \
+		{                                                                                            \
+			classify_inside_octagon_body(points_x, points_y, count, edge_a, edge_b, edge_c, edge_margin, is_inside); \
+		}                                                                                            \
+		QUICK_HULL_KERNEL_TARGET(isa) static void classify_inside_polygon_##suffix                   \
+		(const Vector2 * points, int count, const double * edge_start_x, const double * edge_start_y, \
+		 const double * edge_delta_x, const double * edge_delta_y, int edge_count, unsigned char * classes) \
+		{                                                                                            \
+			classify_inside_polygon_body(points, count, edge_start_x, edge_start_y, edge_delta_x, edge_delta_y, edge_count, classes); \
+		}                                                                                            \
+		QUICK_HULL_KERNEL_TARGET(isa) static void classify_inside_polygon_angular_##suffix           \
+		(const Vector2 * points, int count, Vector2 center, const double * vertex_x,                 \
+		 const double * vertex_y, const double * vertex_angles, int search_size, int vertex_count, unsigned char * classes) \
+		{                                                                                            \
+			classify_inside_polygon_angular_body(points, count, center, vertex_x, vertex_y, vertex_angles, search_size, vertex_count, classes); \
+		}
+
+	QUICK_HULL_DEFINE_KERNELS(sse2, "sse2")
+#if QUICK_HULL_KERNEL_DISPATCH
+	QUICK_HULL_DEFINE_KERNELS(avx2, "avx2,fma")
+	QUICK_HULL_DEFINE_KERNELS(avx512, "avx512f,avx512vl,avx2,fma")
+#endif
+
+	static const Kernel_Set kernels_sse2 = 
+	{ 
+		Kernel_Isa::Sse2, compute_orientations_sse2, classify_inside_octagon_sse2, 
+		classify_inside_polygon_sse2, classify_inside_polygon_angular_sse2 
+	};
+#if QUICK_HULL_KERNEL_DISPATCH
+	static const Kernel_Set kernels_avx2 = 
+	{ 
+		Kernel_Isa::Avx2, compute_orientations_avx2, classify_inside_octagon_avx2, 
+		classify_inside_polygon_avx2, classify_inside_polygon_angular_avx2 
+	};
+	static const Kernel_Set kernels_avx512 = 
+	{ 
+		Kernel_Isa::Avx512, compute_orientations_avx512, classify_inside_octagon_avx512, 
+		classify_inside_polygon_avx512, classify_inside_polygon_angular_avx512 
+	};
+#endif
+
+
+	// * Selection
+
+	static bool is_kernel_isa_supported(Kernel_Isa isa)
+	{
+		switch (isa)
+		{
+			case Kernel_Isa::Sse2: return true;
+#if QUICK_HULL_KERNEL_DISPATCH
+			case Kernel_Isa::Avx2: 
+				return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+			case Kernel_Isa::Avx512: 
+				return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl") && is_kernel_isa_supported(Kernel_Isa::Avx2);
+#endif
+			default: return false;
+		}
+	}
+
+	static const Kernel_Set & get_kernels_of(Kernel_Isa isa)
+	{
+		switch (isa)
+		{
+#if QUICK_HULL_KERNEL_DISPATCH
+			case Kernel_Isa::Avx2:   return kernels_avx2;
+			case Kernel_Isa::Avx512: return kernels_avx512;
+#endif
+			default: return kernels_sse2;
+		}
+	}
+
+	// ..selected once (function local statics are initialized thread safely)
+	static const Kernel_Set * & get_selected_kernels()
+	{
+		static const Kernel_Set * selected_kernels = &get_kernels_of(detect_kernel_isa());
+		return selected_kernels;
+	}
+
+
+	Kernel_Isa detect_kernel_isa()
+	{
+		if (is_kernel_isa_supported(Kernel_Isa::Avx512)) return Kernel_Isa::Avx512;
+		if (is_kernel_isa_supported(Kernel_Isa::Avx2)) return Kernel_Isa::Avx2;
+
+		return Kernel_Isa::Sse2;
+	}
+
+	bool set_kernel_isa(Kernel_Isa isa)
+	{
+		if (!is_kernel_isa_supported(isa)) return false;
+
+		get_selected_kernels() = &get_kernels_of(isa);
+		return true;
+	}
+
+	const Kernel_Set & get_kernels()
+	{
+		return *get_selected_kernels();
+	}
+
+	std::string get_kernel_isa_name(Kernel_Isa isa)
+	{
+		switch (isa)
+		{
+			case Kernel_Isa::Sse2:   return "sse2";
+			case Kernel_Isa::Avx2:   return "avx2";
+			case Kernel_Isa::Avx512: return "avx512";
+		}
+
+		return "unknown";
+	}
+
+	bool try_parse_kernel_isa(const std::string & name, Kernel_Isa & result_isa)
+	{
+		for (auto isa : { Kernel_Isa::Sse2, Kernel_Isa::Avx2, Kernel_Isa::Avx512 })
+		{
+			if (name == get_kernel_isa_name(isa)) 
+			{
+				result_isa = isa;
+				return true;
+			}
+		}
+
+		return false;
+	}
+}
\ No newline at end of file
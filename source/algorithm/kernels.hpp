@@ -0,0 +1,109 @@
+#pragma once
+
+// standard
+#include <cmath>
+#include <string>
+
+// internal
+#include "core.hpp"
+
+namespace quick_hull 
+{
+	// Kernels process points in blocks of this size (so their outputs fit on the stack)
+	static const int kernel_block_size = 256;
+
+
+	// Returns a pseudo-angle in [0, 4) of the direction (increasing counter-clockwise from +x like its angle, 
+	// without trigonometry), the zero direction gives NaN
+	static inline double get_pseudo_angle(double x, double y)
+	{
+		double t = y / (std::fabs(x) + std::fabs(y));
+
+		return x >= 0 ? (y >= 0 ? t : 4 + t) : 2 - t;
+	}
+
+
+	// Instruction sets of the kernel variants (ordered from the oldest)
+	enum class Kernel_Isa 
+	{
+		Sse2, 
+		Avx2, 
+		Avx512
+	};
+
+
+	// Data-parallel loops compiled for several instruction sets, the variant is selected at runtime by cpuid
+	struct Kernel_Set 
+	{
+		public: // fields
+			Kernel_Isa isa;
+
+			// Writes filtered orientations (twice the ABE triangle areas) of the points and their absolute error bounds
+			void (* compute_orientations)
+			(
+				Vector2         a, 
+				Vector2         b, 
+				const Vector2 * points, 
+				int             count, 
+				double        * orientations, 
+				double        * errors
+			);
+
+			// Writes 1 for points, which are strictly inside all the 8 edges (A*x + B*y + C > margin), 0 otherwise
+			void (* classify_inside_octagon)
+			(
+				const float   * points_x, 
+				const float   * points_y, 
+				int             count, 
+				const float   * edge_a, 
+				const float   * edge_b, 
+				const float   * edge_c, 
+				const float   * edge_margin, 
+				unsigned char * is_inside
+			);
+
+			// Classifies points against the counter-clockwise convex polygon by all its edges (for small polygons):
+			// writes 1 for points inside or on the boundary, 0 for points outside and 2 when the filtered orientation is uncertain
+			void (* classify_inside_polygon)
+			(
+				const Vector2 * points, 
+				int             count, 
+				const double  * edge_start_x, 
+				const double  * edge_start_y, 
+				const double  * edge_delta_x, 
+				const double  * edge_delta_y, 
+				int             edge_count, 
+				unsigned char * classes
+			);
+
+			// Classifies points against the counter-clockwise convex polygon by the binary search of their wedge 
+			// around the center (vertices start at the smallest pseudo-angle, the first one is repeated after the last one).
+			// The angles are padded by values above 4 to the power of two search size, so all points take the same steps.
+			// Writes classes as above, points near a wedge ray are uncertain too.
+			void (* classify_inside_polygon_angular)
+			(
+				const Vector2 * points, 
+				int             count, 
+				Vector2         center, 
+				const double  * vertex_x, 
+				const double  * vertex_y, 
+				const double  * vertex_angles, 
+				int             search_size, 
+				int             vertex_count, 
+				unsigned char * classes
+			);
+	};
+
+
+	// Returns the newest instruction set supported by the CPU (and compiled in)
+	Kernel_Isa detect_kernel_isa();
+
+	// Returns false when the CPU does not support the instruction set (the detected one stays in use)
+	bool set_kernel_isa(Kernel_Isa isa);
+
+	// Returns kernels of the detected (or set) instruction set
+	const Kernel_Set & get_kernels();
+
+	std::string get_kernel_isa_name(Kernel_Isa isa);
+	bool try_parse_kernel_isa(const std::string & name, Kernel_Isa & result_isa);
+}
\ No newline at end of file
@@ -0,0 +1,258 @@
+// standard
+#include <cmath>
+#include <cfloat>
+#include <algorithm>
+
+// external
+#include "omp.h"
+
+// internal
+#include "predicates.hpp"
+#include "algorithm/kernels.hpp"
+#include "algorithm/mixed_precision.hpp"
+
+namespace quick_hull 
+{
+	// Points are processed in blocks (independently of the thread count, so the refined points keep their order)
+	static const int block_size = 4096;
+
+	// Directions of the octagon vertices in counter-clockwise order, starting from the most left point
+	static const int   octagon_size = 8;
+	static const float octagon_directions[octagon_size][2] = 
+	{
+		{ -1,  0 }, { -1, -1 }, {  0, -1 }, {  1, -1 },
+		{  1,  0 }, {  1,  1 }, {  0,  1 }, { -1,  1 }
+	};
+
+
+	// Returns true when the polygon is strictly convex and counter-clockwise (removes collinear vertices)
+	static bool try_make_convex_polygon(std::vector<Vector2> & polygon)
+	{
+		// ..removes duplicated and not strictly convex vertices
+		bool is_changed = true;
+
+		while (is_changed && polygon.size() >= 3) 
+		{
+			is_changed = false;
+
+			for (int index = 0; index < polygon.size() && polygon.size() >= 3; index++)
+			{
+				int count = polygon.size();
+				const auto & previous = polygon[(index + count - 1) % count];
+				const auto & next     = polygon[(index + 1) % count];
+
+				if (predicates::orientation(previous, polygon[index], next) <= 0)
+				{
+					polygon.erase(polygon.begin() + index);
+					is_changed = true;
+					index--;
+				}
+			}
+		}
+
+		if (polygon.size() < 3) return false;
+
+		// ..every vertex has to be on the left side of every edge (otherwise the polygon winds more than once)
+		int count = polygon.size();
+
+		for (int edge = 0; edge < count; edge++)
+		{
+			for (int index = 0; index < count; index++)
+			{
+				if (predicates::orientation(polygon[edge], polygon[(edge + 1) % count], polygon[index]) < 0) return false;
+			}
+		}
+
+		return true;
+	}
+
+
+	Algorithm_Mixed_Precision::~Algorithm_Mixed_Precision() 
+	{
+		if (is_owning_refinement) delete refinement;
+	}
+
+	Algorithm_Mixed_Precision::Algorithm_Mixed_Precision(Algorithm * refinement, bool is_owning_refinement, int thread_count)
+	{
+		this->refinement = refinement;
+		this->is_owning_refinement = is_owning_refinement;
+		this->thread_count = thread_count;
+		this->filtered_point_count = 0;
+		this->refined_point_count = 0;
+	}
+
+	std::vector<Vector2> * Algorithm_Mixed_Precision::run(const Point_Buffer &points)
+	{
+		int point_count  = points.size();
+		int block_count  = (point_count + block_size - 1) / block_size;
+		int thread_count = this->thread_count > 0 ? this->thread_count : omp_get_max_threads(); // ..the process-wide setting is not changed
+
+		this->filtered_point_count = 0;
+		this->refined_point_count = point_count;
+
+		// 1. Converts points into float32 (structure of arrays) and finds the octagon vertices
+		points_x.resize(point_count);
+		points_y.resize(point_count);
+
+		std::vector<int>   block_extreme_indices(block_count * octagon_size);
+		std::vector<float> block_max_magnitudes(block_count);
+
+		#pragma omp parallel for schedule(static) num_threads(thread_count)
+		for (int block = 0; block < block_count; block++)
+		{
+			int start = block * block_size;
+			int end   = std::min(start + block_size, point_count);
+
+			float extreme_values[octagon_size];
+			int   extreme_indices[octagon_size];
+			float max_magnitude = 0;
+
+			for (int direction = 0; direction < octagon_size; direction++) 
+			{
+				extreme_values[direction] = -FLT_MAX;
+				extreme_indices[direction] = start;
+			}
+
+			for (int index = start; index < end; index++)
+			{
+				float x = (float)points[index].x;
+				float y = (float)points[index].y;
+
+				points_x[index] = x;
+				points_y[index] = y;
+
+				max_magnitude = std::max(max_magnitude, std::max(std::fabs(x), std::fabs(y)));
+
+				for (int direction = 0; direction < octagon_size; direction++)
+				{
+					float value = octagon_directions[direction][0] * x + octagon_directions[direction][1] * y;
+
+					if (value > extreme_values[direction])
+					{
+						extreme_values[direction] = value;
+						extreme_indices[direction] = index;
+					}
+				}
+			}
+
+			for (int direction = 0; direction < octagon_size; direction++) 
+			{
+				block_extreme_indices[block * octagon_size + direction] = extreme_indices[direction];
+			}
+
+			block_max_magnitudes[block] = max_magnitude;
+		}
+
+		// ..reduces blocks (the comparison is repeated in float, so the chosen points are the same as of a single pass)
+		int   extreme_indices[octagon_size];
+		float max_magnitude = 0;
+
+		for (int direction = 0; direction < octagon_size; direction++)
+		{
+			float extreme_value = -FLT_MAX;
+			extreme_indices[direction] = 0;
+
+			for (int block = 0; block < block_count; block++)
+			{
+				int index = block_extreme_indices[block * octagon_size + direction];
+				float value = octagon_directions[direction][0] * points_x[index] + octagon_directions[direction][1] * points_y[index];
+
+				if (value > extreme_value)
+				{
+					extreme_value = value;
+					extreme_indices[direction] = index;
+				}
+			}
+		}
+
+		for (int block = 0; block < block_count; block++) max_magnitude = std::max(max_magnitude, block_max_magnitudes[block]);
+
+		// Octagon of input points (double precision), the float comparison may pick not exactly extreme points,
+		// so it is checked with exact predicates to be convex (then it is inside the convex hull)
+		std::vector<Vector2> octagon;
+		for (int direction = 0; direction < octagon_size && point_count > 0; direction++) 
+		{
+			octagon.push_back(points[extreme_indices[direction]]);
+		}
+
+		// ..overflowing float32 coordinates can not be filtered
+		double magnitude = (double)max_magnitude * (1 + FLT_EPSILON);
+		bool is_filtering = std::isfinite(magnitude) && magnitude < FLT_MAX / 64 && try_make_convex_polygon(octagon);
+
+		if (!is_filtering) 
+		{
+			return refinement->run(points);
+		}
+
+		// 2. Filters points strictly inside the octagon
+		//    Edge PQ as the line A*x + B*y + C (the orientation of P, Q and the point), 
+		//    the margin bounds rounding of coefficients, coordinates and the float32 evaluation
+		float edge_a[octagon_size], edge_b[octagon_size], edge_c[octagon_size], edge_margin[octagon_size];
+		int edge_count = octagon.size();
+
+		for (int edge = 0; edge < octagon_size; edge++)
+		{
+			if (edge >= edge_count) 
+			{
+				// ..padding edges (every point is inside)
+				edge_a[edge] = 0; edge_b[edge] = 0; edge_c[edge] = 1; edge_margin[edge] = 0;
+				continue;
+			}
+
+			const auto & p = octagon[edge];
+			const auto & q = octagon[(edge + 1) % edge_count];
+
+			double a = p.y - q.y;
+			double b = q.x - p.x;
+			double c = (q.y - p.y) * p.x - (q.x - p.x) * p.y;
+
+			double magnitude_sum = std::fabs(a) * magnitude + std::fabs(b) * magnitude + std::fabs(c);
+
+			edge_a[edge] = (float)a;
+			edge_b[edge] = (float)b;
+			edge_c[edge] = (float)c;
+			edge_margin[edge] = (float)(8 * FLT_EPSILON * magnitude_sum + 8 * FLT_MIN * (std::fabs(a) + std::fabs(b) + 1));
+		}
+
+		std::vector<Point_Buffer> block_refined_points(block_count);
+		const auto & kernels = get_kernels();
+
+		#pragma omp parallel for schedule(static) num_threads(thread_count)
+		for (int block = 0; block < block_count; block++)
+		{
+			int start = block * block_size;
+			int count = std::min(block_size, point_count - start);
+
+			const float * block_x = points_x.data() + start;
+			const float * block_y = points_y.data() + start;
+
+			unsigned char is_inside[block_size];
+
+			kernels.classify_inside_octagon(block_x, block_y, count, edge_a, edge_b, edge_c, edge_margin, is_inside);
+
+			auto & refined_points = block_refined_points[block];
+
+			for (int index = 0; index < count; index++)
+			{
+				if (!is_inside[index]) refined_points.push_back(points[start + index]);
+			}
+		}
+
+		// 3. Refines the remaining points in double precision
+		Point_Buffer refined_points;
+		
+		size_t refined_point_count = 0;
+		for (const auto & block_points : block_refined_points) refined_point_count += block_points.size();
+
+		refined_points.reserve(refined_point_count);
+		for (const auto & block_points : block_refined_points) 
+		{
+			refined_points.insert(refined_points.end(), block_points.begin(), block_points.end());
+		}
+
+		this->refined_point_count = refined_point_count;
+		this->filtered_point_count = point_count - refined_point_count;
+
+		return refinement->run(refined_points);
+	}
+}
\ No newline at end of file
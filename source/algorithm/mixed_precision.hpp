@@ -0,0 +1,46 @@
+#pragma once
+
+// standard
+#include <vector>
+
+// internal
+#include "core.hpp"
+#include "./base.hpp"
+
+namespace quick_hull 
+{
+	// Two-phase quick hull: a float32 copy of the points is filtered against an inner octagon (Akl–Toussaint), 
+	// and only the points which might be on the hull are refined by the double precision algorithm.
+	struct Algorithm_Mixed_Precision : public Algorithm
+	{
+		private: // ..settings
+			Algorithm * refinement;            // ..computes the hull of the filtered points
+			bool        is_owning_refinement;  // ..deletes the refinement algorithm on destruction
+			int         thread_count;          // ..threads of the filter (0: the Open MP default)
+
+		private: // ..analytic data
+			int filtered_point_count;
+			int refined_point_count;
+
+		private: // ..buffers (reused between runs)
+			std::vector<float, Default_Init_Allocator<float>> points_x;
+			std::vector<float, Default_Init_Allocator<float>> points_y;
+
+		public: // ..getters (analytic)
+			int get_filtered_point_count() const { return filtered_point_count; }
+			int get_refined_point_count() const { return refined_point_count; }
+
+		public: // constructors & destructors
+			~Algorithm_Mixed_Precision();
+			Algorithm_Mixed_Precision(Algorithm * refinement, bool is_owning_refinement = false, int thread_count = 0);
+
+		public: // setters
+			// ..the refinement checks the control (the filtering phase is a single pass and is not interrupted)
+			void set_control(Run_Control * control) override { this->control = control; refinement->set_control(control); }
+			// ..the filter keeps all possible hull points, so the refinement computes the part of them
+			void set_query(const Hull_Query & query) override { this->query = query; refinement->set_query(query); }
+
+		public: // methods
+			std::vector<Vector2> * run(const Point_Buffer &points) override;
+	};
+}
\ No newline at end of file
@@ -2,23 +2,66 @@
 #include <iostream>
 #include <sstream>
 #include <vector>
+#include <chrono>
+#include <algorithm>
 
 // external
 #include "omp.h"
 
+#if __linux__
+	#include <sched.h>
+#endif
+
 // internal
 #include "algorithm/openmp.hpp"
 
 namespace quick_hull 
 {
+	// Frames with fewer points are partitioned by the thread, which found them (a task costs more than the work)
+	static const int task_point_threshold = 4096;
+
+
 	Algorithm_OpenMP::~Algorithm_OpenMP() 
 	{
 
 	}
 
+	Algorithm_OpenMP::Algorithm_OpenMP(bool is_collecting_statistics, int thread_count) 
+	{
+		this->is_collecting_statistics = is_collecting_statistics;
+		this->thread_count = thread_count;
+		this->trace = nullptr;
+		this->root_scans = nullptr;
+	}
+
 
-	std::vector<Vector2> * Algorithm_OpenMP::run(const std::vector<Vector2> &points)
+	std::vector<Vector2> * Algorithm_OpenMP::run(const Point_Buffer &points)
 	{
+		// ..the team size is passed to the parallel region (the process-wide Open MP setting is not changed), 
+		// so instances with own thread counts can run concurrently from different threads
+		int thread_count = this->thread_count > 0 ? this->thread_count : omp_get_max_threads();
+
+		// Resets analytic data
+		this->statistics.clear();
+		this->thread_statistics.clear();
+
+		if (is_collecting_statistics) 
+		{
+			this->thread_statistics.resize(thread_count);
+		}
+
+		if (trace != nullptr) 
+		{
+			trace->reset(thread_count);
+		}
+
+		if (root_scans != nullptr) 
+		{
+			root_scans->assign(thread_count, Root_Scan { -1, nullptr, 0, 0 });
+		}
+
+		if (control != nullptr) control->begin(points.size());
+
 		// Convex hull 
 		auto *convex_hull = new std::vector<Vector2>();
 
@@ -27,145 +70,342 @@ namespace quick_hull
 		
 		int point_count = points.size();
 
-		// Finds the most left and right point coordinates
-		for (int index = 0; index < point_count; index++)
+		// Each thread scans the same static part of the input, which it has first touched while reading (so on its NUMA node).
+		// Parts of both sides are kept in thread buffers and copied into the side buffers by the same threads.
+		std::vector<Vector2> thread_most_left(thread_count, most_left);
+		std::vector<Vector2> thread_most_right(thread_count, most_right);
+
+		std::vector<Farest_Point_Search>  lower_searches; // ..right side of the line from the most left to the most right point
+		std::vector<Farest_Point_Search>  upper_searches; // ..right side of the reversed line
+		std::vector<Point_Buffer>         thread_lower_points(thread_count);
+		std::vector<Point_Buffer>         thread_upper_points(thread_count);
+		std::vector<size_t>               lower_offsets(thread_count + 1, 0);
+		std::vector<size_t>               upper_offsets(thread_count + 1, 0);
+
+		Point_Buffer lower_points;
+		Point_Buffer upper_points;
+
+		bool is_lower_asked  = query.has_lower_side(); // ..sides, which the query does not ask for, are not collected
+		bool is_upper_asked  = query.has_upper_side();
+		bool is_root_stopped = false; // ..a stopped run does not split the points (the hull is only the most left and right points)
+
+		// Constructs a convex from right and left side of line going through the most left and right points
+		// (tasks write vertices into the linked segments in the hull order)
+		auto * segment_left  = new Hull_Segment();
+		auto * segment_right = new Hull_Segment();
+
+		segment_left->next = segment_right;
+
+		#pragma omp parallel num_threads(thread_count)
 		{
-			const auto &point = points.at(index);
-		
-			if (point.x > most_right.x || (point.x == most_right.x && point.y > most_right.y))
+			int thread_id = omp_get_thread_num();
+			int team_size = omp_get_num_threads();
+
+			int begin = (long long)point_count * thread_id / team_size;
+			int end   = (long long)point_count * (thread_id + 1) / team_size;
+
+			// 1. Finds the most left and right point coordinates of the part
+			auto & part_most_left  = thread_most_left[thread_id];
+			auto & part_most_right = thread_most_right[thread_id];
+
+			for (int index = begin; index < end; index++)
 			{
-				most_right = point;
+				const auto &point = points[index];
+			
+				if (point.x > part_most_right.x || (point.x == part_most_right.x && point.y > part_most_right.y))
+				{
+					part_most_right = point;
+				}
+				else if (point.x < part_most_left.x || (point.x == part_most_left.x && point.y < part_most_left.y)) 
+				{
+					part_most_left  = point;
+				}
 			}
-			else if (point.x < most_left.x || (point.x == most_left.x && point.y < most_left.y)) 
+
+			#pragma omp barrier
+			#pragma omp single
 			{
-				most_left  = point;
+				for (int index = 0; index < team_size; index++)
+				{
+					const auto & point_left  = thread_most_left[index];
+					const auto & point_right = thread_most_right[index];
+
+					if (point_right.x > most_right.x || (point_right.x == most_right.x && point_right.y > most_right.y)) most_right = point_right;
+					if (point_left.x  < most_left.x  || (point_left.x  == most_left.x  && point_left.y  < most_left.y))  most_left  = point_left;
+				}
+
+				lower_searches.assign(team_size, Farest_Point_Search(most_left, most_right));
+				upper_searches.assign(team_size, Farest_Point_Search(most_right, most_left));
+
+				is_root_stopped = control != nullptr && control->should_stop();
 			}
-		}
 
-		// Constructs a convex from right and left side of line going through the most left and right points
-		std::vector<Vector2> *convex_hull_left; 
-		std::vector<Vector2> *convex_hull_right;
-		
-		#pragma omp parallel
-		#pragma omp master
-		{
-			#pragma omp task shared(points, convex_hull_left)
+			// 2. Splits the part by the line in a single pass (both sides share the kernel orientations)
+			std::chrono::steady_clock::time_point stopwatch_start;
+			if (is_collecting_statistics || root_scans != nullptr) stopwatch_start = std::chrono::steady_clock::now();
+
+			long long trace_begin_time = trace != nullptr ? trace->get_time() : 0;
+
+			{
+				const auto & kernels = get_kernels();
+				double orientations[kernel_block_size];
+				double errors[kernel_block_size];
+
+				auto & lower_search = lower_searches[thread_id];
+				auto & upper_search = upper_searches[thread_id];
+				auto & lower_part   = thread_lower_points[thread_id];
+				auto & upper_part   = thread_upper_points[thread_id];
+				int    lower_count  = 0;
+				int    upper_count  = 0;
+
+				// ..sized for the whole part (pages are touched only by the written points)
+				lower_part.resize(end - begin);
+				upper_part.resize(end - begin);
+
+				for (int start = begin; start < end && !is_root_stopped; start += kernel_block_size)
+				{
+					int block_count = std::min(kernel_block_size, end - start);
+
+					kernels.compute_orientations(most_left, most_right, points.data() + start, block_count, orientations, errors);
+
+					for (int index = 0; index < block_count; index++)
+					{
+						const Vector2 & e = points[start + index];
+
+						// ..the reversed line has the opposite orientations
+						if (is_lower_asked && lower_search.consider(e, orientations[index], errors[index])) lower_part[lower_count++] = e;
+						else
+						if (is_upper_asked && upper_search.consider(e, -orientations[index], errors[index])) upper_part[upper_count++] = e;
+					}
+				}
+
+				lower_part.resize(lower_count);
+				upper_part.resize(upper_count);
+			}
+
+			if (is_collecting_statistics || root_scans != nullptr)
+			{
+				auto stopwatch_end = std::chrono::steady_clock::now();
+				double milliseconds = std::chrono::duration<double, std::milli>(stopwatch_end - stopwatch_start).count();
+
+				if (is_collecting_statistics) 
+				{
+					thread_statistics[thread_id].record_grow(
+						0, 
+						end - begin, 
+						thread_lower_points[thread_id].size() + thread_upper_points[thread_id].size(), 
+						milliseconds
+					);
+				}
+
+				if (root_scans != nullptr) 
+				{
+					int cpu = -1;
+#if __linux__
+					cpu = sched_getcpu();
+#endif
+					(*root_scans)[thread_id] = Root_Scan { cpu, points.data() + begin, end - begin, milliseconds };
+				}
+			}
+
+			if (trace != nullptr) 
+			{
+				trace->record(thread_id, trace_begin_time, trace->get_time(), end - begin, 0);
+			}
+
+			#pragma omp barrier
+			#pragma omp single
 			{
-				convex_hull_left = grow(most_left, most_right, points);
+				for (int index = 0; index < team_size; index++) 
+				{
+					lower_offsets[index + 1] = lower_offsets[index] + thread_lower_points[index].size();
+					upper_offsets[index + 1] = upper_offsets[index] + thread_upper_points[index].size();
+
+					// ..merged in the thread order, so the farest point does not depend on the timing
+					if (index > 0) lower_searches[0].merge(lower_searches[index]);
+					if (index > 0) upper_searches[0].merge(upper_searches[index]);
+				}
+
+				lower_points.resize(lower_offsets[team_size]);
+				upper_points.resize(upper_offsets[team_size]);
+
+				// ..points on the line are classified
+				if (control != nullptr) control->add_classified(point_count - (long long)lower_points.size() - (long long)upper_points.size());
 			}
 
-			#pragma omp task shared(points, convex_hull_right)
+			std::copy(thread_lower_points[thread_id].begin(), thread_lower_points[thread_id].end(), lower_points.begin() + lower_offsets[thread_id]);
+			std::copy(thread_upper_points[thread_id].begin(), thread_upper_points[thread_id].end(), upper_points.begin() + upper_offsets[thread_id]);
+
+			#pragma omp barrier
+
+			// 3. Grows both sides (the rest of the threads take spawned tasks at the end of the single)
+			#pragma omp single
 			{
-				convex_hull_right = grow(most_right, most_left, points);
+				const auto & lower_search = lower_searches[0];
+				const auto & upper_search = upper_searches[0];
+
+				segment_left->vertices.push_back(most_left);
+				segment_right->vertices.push_back(most_right);
+
+				if (is_collecting_statistics) 
+				{
+					thread_statistics[thread_id].record_spawned_task(0);
+					thread_statistics[thread_id].record_spawned_task(0);
+				}
+
+				// ..the partitioned points and the segments are used by all descendant tasks, the taskgroup waits for them
+				// (the barrier at the end of the single would wait too, this keeps the lifetime explicit)
+				#pragma omp taskgroup
+				{
+					if (lower_search.is_found()) 
+					{
+						#pragma omp task shared(lower_points) firstprivate(segment_left)
+						{
+							grow_frames(lower_points.data(), { most_left, most_right, lower_search.c, 0, (int)lower_points.size(), 1, Hull_Query::lower_chain_direction_begin, Hull_Query::lower_chain_direction_end }, segment_left);
+						}
+					}
+
+					if (upper_search.is_found()) 
+					{
+						#pragma omp task shared(upper_points) firstprivate(segment_right)
+						{
+							grow_frames(upper_points.data(), { most_right, most_left, upper_search.c, 0, (int)upper_points.size(), 1, Hull_Query::upper_chain_direction_begin, Hull_Query::upper_chain_direction_end }, segment_right);
+						}
+					}
+				}
 			}
 		}
 
-		convex_hull->push_back(most_left);
-		for (auto const point: *convex_hull_left) convex_hull->push_back(point);
+		// Merges analytic data of all threads
+		for (const auto & statistics_of_thread : thread_statistics) 
+		{
+			this->statistics.merge(statistics_of_thread);
+		}
+
+		// Gathers the segments into the output (the only copy of each vertex)
+		size_t vertex_count = 0;
+		for (auto * segment = segment_left; segment != nullptr; segment = segment->next) vertex_count += segment->vertices.size();
 
-		convex_hull->push_back(most_right);
-		for (auto const point: *convex_hull_right) convex_hull->push_back(point);
+		convex_hull->reserve(vertex_count);
 
-		delete convex_hull_right;
-		delete convex_hull_left;
+		for (auto * segment = segment_left; segment != nullptr;)
+		{
+			convex_hull->insert(convex_hull->end(), segment->vertices.begin(), segment->vertices.end());
+
+			auto * next = segment->next;
+			delete segment;
+			segment = next;
+		}
+
+		// ..the upper chain starts at the most right point
+		if (query.part == Hull_Part::Upper) std::rotate(convex_hull->begin(), convex_hull->begin() + 1, convex_hull->end());
+		if (query.is_sector()) select_hull_part(*convex_hull, query);
+
+		if (control != nullptr) control->end();
 
 		return convex_hull;
 	}
 
 
-	std::vector<Vector2> * Algorithm_OpenMP::grow
+	void Algorithm_OpenMP::grow_frames
 	(
-		Vector2 a, 
-		Vector2 b, 
-		const std::vector<Vector2> &points
+		Vector2      * points, 
+		Grow_Frame     root_frame,
+		Hull_Segment * segment
 	)
 	{
-		int thread_id = omp_get_thread_num();
-
-		// {
-		// 	std::stringstream log;
-		// 	log << "thread: " << thread_id << std::endl;
-		// 	std::cout << log.str();
-		// }
-
-		Vector2 ab = b - a;
-		Vector2 ab_normal = ab.get_conter_clockwise_normal();
+		int thread_id = omp_get_thread_num(); // ..tasks are tied, so the thread does not change
 
-		Vector2 c = a;                 // the farest point from AB line.
-		double  sqr_distance_to_c = 0; // the srotest square distance from the AB line to the C point.
+		// Explicit work stack instead of recursion (hulls with millions of vertices would overflow the call stack)
+		std::vector<Grow_Frame> stack;
+		bool is_sector = query.is_sector();
+		stack.push_back(root_frame);
 
-		int point_count = points.size();
+		while (!stack.empty())
+		{
+			Grow_Frame frame = stack.back();
+			stack.pop_back();
 
-		// Vector to store the resulted convex hell
-		auto *convex_hull = new std::vector<Vector2>(
-			// point_count
-			);
+			// ..vertex frame
+			if (frame.begin == frame.end) 
+			{
+				segment->vertices.push_back(frame.a);
+				continue;
+			}
 
-		// Subsets of the given points, which lays on the conter clockwise normal side of the AB line.
-		auto *relative_points = new std::vector<Vector2>(
-			// point_count
-			);
+			// ..chains facing away from the asked sector are skipped
+			if (is_sector && !query.is_chain_facing(frame.direction_begin, frame.direction_end)) continue;
 
+			// ..a stopped run emits the known farest point of the frame instead of partitioning it (no tasks are spawned)
+			if (control != nullptr && (control->was_stopped() || (frame.end - frame.begin >= control_check_point_count && control->should_stop())))
+			{
+				segment->vertices.push_back(frame.c);
+				continue;
+			}
 
-		for (int index = 0; index < point_count; index++)
-		{
-			auto e = points.at(index);
-			Vector2 d = Vector2::project(e - a, ab) + a; // projection of the point E
-			Vector2 de = e - d;                 // projection (as vector) from the point D to E
+			// Large frames are spawned as tasks while this thread has other work on its stack
+			if (frame.end - frame.begin >= task_point_threshold && !stack.empty()) 
+			{
+				if (is_collecting_statistics) thread_statistics[thread_id].record_spawned_task(frame.depth);
 
-			double relativity = Vector2::dot_product(de, ab_normal);
-			double projection_sqr_magnitude = de.get_sqr_magnitude();
+				// ..the task gets its own segment, vertices after it go into a new one
+				// (only the owner of a segment links new segments after it)
+				auto * task_segment = new Hull_Segment();
+				auto * next_segment = new Hull_Segment();
 
-			if (relativity > 0)
-			{
-				auto e = points.at(index);
+				next_segment->next = segment->next;
+				task_segment->next = next_segment;
+				segment->next = task_segment;
 
-				if (projection_sqr_magnitude > sqr_distance_to_c) 
+				#pragma omp task firstprivate(points, frame, task_segment)
 				{
-					c = e;
-					sqr_distance_to_c = projection_sqr_magnitude;
+					grow_frames(points, frame, task_segment);
 				}
 
-				relative_points->push_back(e);
+				segment = next_segment;
+				continue;
 			}
-		}
 
-		if (c != a && c != b)
-		{
-			std::vector<Vector2> *convex_hull_left;
-			std::vector<Vector2> *convex_hull_right;
-
-			// if (relative_points->size() < 2000) 
-			// {
-			// 	convex_hull_left  = grow(a, c, *relative_points); // a convex hull from the AC line 
-			// }
-			// else 
-			// {
-				#pragma omp task shared(convex_hull_left, relative_points)
-				{
-					convex_hull_left  = grow(a, c, *relative_points); // a convex hull from the AC line 
-				}
-			// }
+			// Captures partitioning start time (only when statistics are collected)
+			std::chrono::steady_clock::time_point stopwatch_start;
+			if (is_collecting_statistics) stopwatch_start = std::chrono::steady_clock::now();
+
+			long long trace_begin_time = trace != nullptr ? trace->get_time() : 0;
 
-			// #pragma omp task shared(convex_hull_right, relative_points)
+			Farest_Point_Search left_search(frame.a, frame.c);  // ..AC line
+			Farest_Point_Search right_search(frame.c, frame.b); // ..CB line
+			int left_end, right_begin;
+
+			partition_around_farest_point(points, frame.begin, frame.end, left_search, right_search, left_end, right_begin);
+
+			if (is_collecting_statistics)
 			{
-				convex_hull_right = grow(c, b, *relative_points); // a convex hull from the CB line
+				auto stopwatch_end = std::chrono::steady_clock::now();
+
+				thread_statistics[thread_id].record_grow(
+					frame.depth, 
+					frame.end - frame.begin, 
+					(left_end - frame.begin) + (frame.end - right_begin), 
+					std::chrono::duration<double, std::milli>(stopwatch_end - stopwatch_start).count()
+				);
 			}
 
-			#pragma omp taskwait
+			if (trace != nullptr) 
+			{
+				trace->record(thread_id, trace_begin_time, trace->get_time(), frame.end - frame.begin, frame.depth);
+			}
 
-			for (auto const point: *convex_hull_left) convex_hull->push_back(point);
+			// ..the farest point and the points inside the ACB triangle are classified
+			if (control != nullptr) control->add_classified((frame.end - frame.begin) - (left_end - frame.begin) - (frame.end - right_begin));
 
-			convex_hull->push_back(c);
-			
-			for (auto const point: *convex_hull_right) convex_hull->push_back(point);
+			// ..the AC chain turns up to the AB direction (C is the farest point) and the CB chain turns on from it
+			double direction_ab = is_sector ? get_chain_direction(frame.a, frame.b, frame.direction_begin, frame.direction_end) : 0;
 
-			delete convex_hull_left;
-			delete convex_hull_right;
+			// Frames are popped in the reversed order: the AC side, the C vertex and the CB side
+			if (right_search.is_found()) stack.push_back({ frame.c, frame.b, right_search.c, right_begin, frame.end, frame.depth + 1, direction_ab, frame.direction_end });
+			stack.push_back({ frame.c, frame.c, frame.c, 0, 0, frame.depth });
+			if (left_search.is_found()) stack.push_back({ frame.a, frame.c, left_search.c, frame.begin, left_end, frame.depth + 1, frame.direction_begin, direction_ab });
 		}
 
-		delete relative_points;
-		
-		return convex_hull;
 	}
 }
\ No newline at end of file
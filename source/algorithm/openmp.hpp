@@ -6,21 +6,69 @@
 // internal
 #include "core.hpp"
 #include "./base.hpp"
+#include "./statistics.hpp"
+#include "./tracing.hpp"
+#include "./farest_point.hpp"
 
 namespace quick_hull 
 {
+	// Part of the resulted convex hull written by a single task, segments are linked in the hull order
+	struct Hull_Segment 
+	{
+		public: // fields
+			std::vector<Vector2> vertices;
+			Hull_Segment       * next = nullptr;
+	};
+
+
+	// Root pass of a single thread: it scans a static part of the input (the part it has first touched while reading)
+	struct Root_Scan 
+	{
+		public: // fields
+			int             cpu;          // ..-1 when unknown
+			const Vector2 * points;
+			int             point_count;
+			double          milliseconds;
+	};
+
+
 	struct Algorithm_OpenMP : public Algorithm
 	{
-		public: // methods
+		private: // ..settings
+			bool is_collecting_statistics;
+			int  thread_count;             // ..team size of each run (0: the Open MP default), owned by the instance
+
+		private: // ..analytic data
+			Recursion_Statistics              statistics;
+			std::vector<Recursion_Statistics> thread_statistics; // ..written only by the owner thread, merged after run
+			Task_Trace                      * trace;             // ..records grow tasks when set
+			std::vector<Root_Scan>          * root_scans;        // ..records root passes of threads when set
+
+		public: // ..getters (analytic)
+			const Recursion_Statistics & get_statistics() const { return statistics; }
+
+		public: // ..getters
+			int get_thread_count() const { return thread_count; }
+
+		public: // ..setters
+			void set_thread_count(int thread_count) { this->thread_count = thread_count; }
+			void set_trace(Task_Trace * trace) { this->trace = trace; }
+			void set_root_scans(std::vector<Root_Scan> * root_scans) { this->root_scans = root_scans; }
+
+		public: // constructors & destructors
 			~Algorithm_OpenMP();
+			Algorithm_OpenMP(bool is_collecting_statistics = false, int thread_count = 0);
+
+		public: // methods
+			std::vector<Vector2> * run(const Point_Buffer &points) override;
 
-			std::vector<Vector2> * run(const std::vector<Vector2> &points) override;
 		private: // methods
-			std::vector<Vector2> * grow
+			// Processes the frame (and its subframes) with a local work stack, large subframes are spawned as tasks
+			void grow_frames
 			(
-				Vector2 a,
-				Vector2 b,
-				const std::vector<Vector2> &points
+				Vector2      * points,
+				Grow_Frame     root_frame,
+				Hull_Segment * segment
 			);
 	};
 }
\ No newline at end of file
@@ -1,19 +1,32 @@
 // standard
 #include <iostream>
 #include <sstream>
+#include <chrono>
+#include <algorithm>
 
 // external
 #include "omp.h"
 
 // internal
+#include "algorithm/farest_point.hpp"
 #include "algorithm/sequential.hpp"
 
 namespace quick_hull 
 {
 	Algorithm_Sequential::~Algorithm_Sequential() { }
 
-	std::vector<Vector2> * Algorithm_Sequential::run(const std::vector<Vector2> &points)
+	Algorithm_Sequential::Algorithm_Sequential(bool is_collecting_statistics) 
 	{
+		this->is_collecting_statistics = is_collecting_statistics;
+	}
+
+	std::vector<Vector2> * Algorithm_Sequential::run(const Point_Buffer &points)
+	{
+		// Resets analytic data
+		this->statistics.clear();
+
+		if (control != nullptr) control->begin(points.size());
+
 		// Convex hull 
 		auto *convex_hull = new std::vector<Vector2>();
 
@@ -28,89 +41,126 @@ namespace quick_hull
 				most_right = point;
 			}
 			else
-			if (point.x < most_left.x || (point.x == most_right.x && point.y < most_right.y)) 
+			if (point.x < most_left.x || (point.x == most_left.x && point.y < most_left.y)) 
 			{
 				most_left  = point;
 			}
 		}
 
 		// Constructs a convex from right and left side of line going through the most left and right points
-		auto *convex_hull_left  = grow(most_left, most_right, points);
-		auto *convex_hull_right = grow(most_right, most_left, points);
-
+		// (vertices are appended directly in the hull order), sides are skipped when the query does not ask for them
 		convex_hull->push_back(most_left);
-		for (auto const point: *convex_hull_left) convex_hull->push_back(point);
+		if (query.has_lower_side()) grow(most_left, most_right, points, 0, Hull_Query::lower_chain_direction_begin, Hull_Query::lower_chain_direction_end, *convex_hull);
 
 		convex_hull->push_back(most_right);
-		for (auto const point: *convex_hull_right) convex_hull->push_back(point);
+		if (query.has_upper_side()) grow(most_right, most_left, points, 0, Hull_Query::upper_chain_direction_begin, Hull_Query::upper_chain_direction_end, *convex_hull);
 
-		delete convex_hull_right;
-		delete convex_hull_left;
+		// ..the upper chain starts at the most right point
+		if (query.part == Hull_Part::Upper) std::rotate(convex_hull->begin(), convex_hull->begin() + 1, convex_hull->end());
+		if (query.is_sector()) select_hull_part(*convex_hull, query);
+
+		if (control != nullptr) control->end();
 
 		return convex_hull;
 	}
 
 
-	std::vector<Vector2> * Algorithm_Sequential::grow
+	void Algorithm_Sequential::grow
 	(
 		Vector2 a, 
 		Vector2 b, 
-		const std::vector<Vector2> &points
+		const Point_Buffer &points,
+		int depth,
+		double direction_begin,
+		double direction_end,
+		std::vector<Vector2> &convex_hull
 	)
 	{
-		Vector2 ab = b - a;
-		Vector2 ab_normal = ab.get_conter_clockwise_normal();
+		// ..a stopped run keeps only the vertices found so far
+		if (control != nullptr && control->should_stop()) return;
 
-		Vector2 c = a;                 // the farest point from AB line.
-		double  sqr_distance_to_c = 0; // the srotest square distance from the AB line to the C point.
+		// Captures partitioning start time (only when statistics are collected)
+		std::chrono::steady_clock::time_point stopwatch_start;
+		if (is_collecting_statistics) stopwatch_start = std::chrono::steady_clock::now();
 
-		// Vector to store the resulted convex hell
-		auto *convex_hull = new std::vector<Vector2>();
+		// Subset of the given points, which lays on the right side of the AB line (so the hull is counter-clockwise).
+		// Deeper levels partition it in place, so no other point buffers are allocated.
+		Point_Buffer relative_points(points.size());
+		Farest_Point_Search search(a, b);
+
+		relative_points.resize(search.filter(points.data(), points.size(), relative_points.data()));
+
+		if (is_collecting_statistics)
+		{
+			auto stopwatch_end = std::chrono::steady_clock::now();
+
+			statistics.record_grow(
+				depth, 
+				points.size(), 
+				relative_points.size(), 
+				std::chrono::duration<double, std::milli>(stopwatch_end - stopwatch_start).count()
+			);
+		}
 
-		// Subsets of the given points, which lays on the conter clockwise normal side of the AB line.
-		auto *relative_points = new std::vector<Vector2>();
+		if (!search.is_found()) return;
 
-		for (auto e : points)
+		// Explicit work stack instead of recursion (hulls with millions of vertices would overflow the call stack)
+		std::vector<Grow_Frame> stack;
+		bool is_sector = query.is_sector();
+		stack.push_back({ a, b, search.c, 0, (int)relative_points.size(), depth + 1, direction_begin, direction_end });
+
+		while (!stack.empty())
 		{
-			Vector2 d = Vector2::project(e - a, ab) + a; // projection of the point E
-			Vector2 de = e - d;                 // projection (as vector) from the point D to E
+			Grow_Frame frame = stack.back();
+			stack.pop_back();
 
-			double relativity = Vector2::dot_product(de, ab_normal);
-			
-			if (relativity > 0)
+			// ..vertex frame
+			if (frame.begin == frame.end) 
 			{
-				double projection_sqr_magnitude = de.get_sqr_magnitude();
+				convex_hull.push_back(frame.a);
+				continue;
+			}
 
-				if (projection_sqr_magnitude > sqr_distance_to_c) 
-				{
-					c = e;
-					sqr_distance_to_c = projection_sqr_magnitude;
-				}
+			// ..chains facing away from the asked sector are skipped
+			if (is_sector && !query.is_chain_facing(frame.direction_begin, frame.direction_end)) continue;
 
-				relative_points->push_back(e);
+			// ..a stopped run emits the known farest point of the frame instead of partitioning it
+			if (control != nullptr && (control->was_stopped() || (frame.end - frame.begin >= control_check_point_count && control->should_stop())))
+			{
+				convex_hull.push_back(frame.c);
+				continue;
 			}
-		}
 
-		if (c != a && c != b)
-		{
-			std::vector<Vector2> *convex_hull_left;
-			std::vector<Vector2> *convex_hull_right;
+			if (is_collecting_statistics) stopwatch_start = std::chrono::steady_clock::now();
+
+			Farest_Point_Search left_search(frame.a, frame.c);  // ..AC line
+			Farest_Point_Search right_search(frame.c, frame.b); // ..CB line
+			int left_end, right_begin;
 
-			convex_hull_left  = grow(a, c, *relative_points); // a convex hull from the AC line 
-			convex_hull_right = grow(c, b, *relative_points); // a convex hull from the CB line
+			partition_around_farest_point(relative_points.data(), frame.begin, frame.end, left_search, right_search, left_end, right_begin);
 
-			for (auto const point: *convex_hull_left) convex_hull->push_back(point);
+			if (is_collecting_statistics)
+			{
+				auto stopwatch_end = std::chrono::steady_clock::now();
+
+				statistics.record_grow(
+					frame.depth, 
+					frame.end - frame.begin, 
+					(left_end - frame.begin) + (frame.end - right_begin), 
+					std::chrono::duration<double, std::milli>(stopwatch_end - stopwatch_start).count()
+				);
+			}
 
-			convex_hull->push_back(c);
-			
-			for (auto const point: *convex_hull_right) convex_hull->push_back(point);
+			// ..the farest point and the points inside the ACB triangle are classified
+			if (control != nullptr) control->add_classified((frame.end - frame.begin) - (left_end - frame.begin) - (frame.end - right_begin));
 
-			delete convex_hull_left;
-			delete convex_hull_right;
-		}
+			// ..the AC chain turns up to the AB direction (C is the farest point) and the CB chain turns on from it
+			double direction_ab = is_sector ? get_chain_direction(frame.a, frame.b, frame.direction_begin, frame.direction_end) : 0;
 
-		delete relative_points;
-		
-		return convex_hull;
+			// Frames are popped in the reversed order: the AC side, the C vertex and the CB side
+			if (right_search.is_found()) stack.push_back({ frame.c, frame.b, right_search.c, right_begin, frame.end, frame.depth + 1, direction_ab, frame.direction_end });
+			stack.push_back({ frame.c, frame.c, frame.c, 0, 0, frame.depth });
+			if (left_search.is_found()) stack.push_back({ frame.a, frame.c, left_search.c, frame.begin, left_end, frame.depth + 1, frame.direction_begin, direction_ab });
+		}
 	}
 }
\ No newline at end of file
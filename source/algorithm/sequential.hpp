@@ -8,24 +8,42 @@
 // internal
 #include "core.hpp"
 #include "./base.hpp"
+#include "./statistics.hpp"
 
 namespace quick_hull
 {
 	// Sequential implementation of the quick hull algorithm
 	struct Algorithm_Sequential : public Algorithm
 	{
-		public: // methods
+		private: // ..settings
+			bool is_collecting_statistics;
+
+		private: // ..analytic data
+			Recursion_Statistics statistics;
+
+		public: // ..getters (analytic)
+			const Recursion_Statistics & get_statistics() const { return statistics; }
+
+		public: // constructors & destructors
 			~Algorithm_Sequential();
+			Algorithm_Sequential(bool is_collecting_statistics = false);
+
+		public: // methods
 
-			std::vector<Vector2> * run(const std::vector<Vector2> &points) override;
+			std::vector<Vector2> * run(const Point_Buffer &points) override;
 
 		private: // methods
-			// Returns convex hull (pointer to allocated data) of the right side for the given AB line for the given points
-			std::vector<Vector2> * grow
+			// Appends convex hull of the right side for the given AB line for the given points
+			// (iteratively, the points subset is partitioned in place by frames of an explicit stack)
+			void grow
 			(
 				Vector2 a, 
 				Vector2 b, 
-				const std::vector<Vector2> &points
+				const Point_Buffer &points,
+				int depth,
+				double direction_begin,
+				double direction_end,
+				std::vector<Vector2> &convex_hull
 			);
 	};
 
@@ -0,0 +1,134 @@
+// standard
+#include <sstream>
+
+// internal
+#include "algorithm/statistics.hpp"
+
+namespace quick_hull 
+{
+	Recursion_Level_Statistics::Recursion_Level_Statistics() : 
+		grow_call_count(0), 
+		discarded_point_count(0), 
+		spawned_task_count(0), 
+		total_time(0)
+	{
+		for (auto & bucket : subset_size_histogram) bucket = 0;
+	}
+
+
+	long long Recursion_Statistics::get_total_grow_call_count() const
+	{
+		long long count = 0;
+		for (const auto & level : levels) count += level.grow_call_count;
+		return count;
+	}
+
+	long long Recursion_Statistics::get_total_spawned_task_count() const
+	{
+		long long count = 0;
+		for (const auto & level : levels) count += level.spawned_task_count;
+		return count;
+	}
+
+	void Recursion_Statistics::clear()
+	{
+		levels.clear();
+	}
+
+	void Recursion_Statistics::merge(const Recursion_Statistics & other)
+	{
+		for (int depth = 0; depth < other.get_depth(); depth++)
+		{
+			auto & level = get_level_for_write(depth);
+			auto & other_level = other.get_level(depth);
+
+			level.grow_call_count       += other_level.grow_call_count;
+			level.discarded_point_count += other_level.discarded_point_count;
+			level.spawned_task_count    += other_level.spawned_task_count;
+			level.total_time            += other_level.total_time;
+
+			for (int bucket = 0; bucket < subset_size_histogram_bucket_count; bucket++)
+			{
+				level.subset_size_histogram[bucket] += other_level.subset_size_histogram[bucket];
+			}
+		}
+	}
+
+	void Recursion_Statistics::record_grow
+	(
+		int    depth, 
+		int    subset_size, 
+		int    relative_subset_size, 
+		double ellapsed_milliseconds
+	)
+	{
+		auto & level = get_level_for_write(depth);
+
+		// Finds a power of two bucket of the subset size
+		int bucket = 0;
+		while ((subset_size >> (bucket + 1)) > 0 && bucket + 1 < subset_size_histogram_bucket_count) bucket++;
+
+		level.grow_call_count += 1;
+		level.discarded_point_count += subset_size - relative_subset_size;
+		level.total_time += ellapsed_milliseconds;
+		level.subset_size_histogram[bucket] += 1;
+	}
+
+	void Recursion_Statistics::record_spawned_task(int depth)
+	{
+		get_level_for_write(depth).spawned_task_count += 1;
+	}
+
+	std::string Recursion_Statistics::get_text() const
+	{
+		std::ostringstream builder;
+
+		builder 
+			<< "{ "
+			<< "\n\t recursion depth: " << get_depth()
+			<< "\n\t grow calls: " << get_total_grow_call_count()
+			<< "\n\t spawned tasks: " << get_total_spawned_task_count();
+
+		for (int depth = 0; depth < get_depth(); depth++)
+		{
+			const auto & level = levels[depth];
+
+			builder 
+				<< "\n\t level " << depth << ": { "
+				<< "calls: " << level.grow_call_count 
+				<< ", discarded: " << level.discarded_point_count 
+				<< ", tasks: " << level.spawned_task_count 
+				<< ", time: " << level.total_time << " ms"
+				<< ", subsets: [";
+
+			bool is_first_bucket = true;
+
+			for (int bucket = 0; bucket < subset_size_histogram_bucket_count; bucket++)
+			{
+				if (level.subset_size_histogram[bucket] == 0) continue;
+
+				builder 
+					<< (is_first_bucket ? " " : ", ") 
+					<< "<2^" << (bucket + 1) << ": " << level.subset_size_histogram[bucket];
+
+				is_first_bucket = false;
+			}
+
+			builder << " ] }";
+		}
+
+		builder << "\n }";
+
+		return builder.str();
+	}
+
+	Recursion_Level_Statistics & Recursion_Statistics::get_level_for_write(int depth)
+	{
+		if (depth >= levels.size()) 
+		{
+			levels.resize(depth + 1);
+		}
+
+		return levels[depth];
+	}
+}
\ No newline at end of file
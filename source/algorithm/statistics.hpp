@@ -0,0 +1,59 @@
+#pragma once
+
+// standard
+#include <string>
+#include <vector>
+
+namespace quick_hull 
+{
+	// Subset sizes are counted in power of two buckets: [0..1], [2..3], [4..7], ...
+	static const int subset_size_histogram_bucket_count = 32;
+
+
+	// Runtime counters of a single recursion level of the [ grow ] function
+	struct Recursion_Level_Statistics
+	{
+		public: // fields
+			long long grow_call_count;
+			long long discarded_point_count; // ..points, which did not get into the subset of the next level
+			long long spawned_task_count;
+			double    total_time;            // ..milliseconds spent on partitioning points
+			long long subset_size_histogram[subset_size_histogram_bucket_count];
+
+		public: // constructors
+			Recursion_Level_Statistics();
+	};
+
+
+	// Per-level runtime counters of the [ grow ] recursion
+	struct Recursion_Statistics 
+	{
+		private: // fields
+			std::vector<Recursion_Level_Statistics> levels;
+
+		public: // getters
+			int get_depth() const { return levels.size(); }
+			const Recursion_Level_Statistics & get_level(int depth) const { return levels[depth]; }
+			long long get_total_grow_call_count() const;
+			long long get_total_spawned_task_count() const;
+
+		public: // methods
+			void clear();
+			void merge(const Recursion_Statistics & other);
+
+			void record_grow
+			(
+				int    depth, 
+				int    subset_size, 
+				int    relative_subset_size, 
+				double ellapsed_milliseconds
+			);
+			void record_spawned_task(int depth);
+
+			// Returns a text block for runtime info (the [ Details ] line)
+			std::string get_text() const;
+
+		private: // methods
+			Recursion_Level_Statistics & get_level_for_write(int depth);
+	};
+}
\ No newline at end of file
@@ -0,0 +1,85 @@
+// standard
+#include <fstream>
+#include <algorithm>
+
+// internal
+#include "algorithm/tracing.hpp"
+
+namespace quick_hull 
+{
+	Task_Trace::Task_Trace(int capacity_per_thread) : 
+		capacity(std::max(1, capacity_per_thread))
+	{
+		reset(0);
+	}
+
+	void Task_Trace::reset(int thread_count)
+	{
+		buffers.resize(thread_count);
+
+		for (auto & buffer : buffers) 
+		{
+			buffer.events.resize(capacity);
+			buffer.written_count = 0;
+		}
+
+		start_time = std::chrono::steady_clock::now();
+	}
+
+	long long Task_Trace::get_dropped_event_count() const
+	{
+		long long count = 0;
+
+		for (const auto & buffer : buffers) 
+		{
+			count += std::max(0LL, buffer.written_count - capacity);
+		}
+
+		return count;
+	}
+
+	bool Task_Trace::write_chrome_trace(const std::string & filepath) const
+	{
+		std::ofstream output(filepath, std::ios::out | std::ios::trunc);
+
+		if (output.fail()) return false;
+
+		// Timestamps are microseconds with nanosecond fraction
+		output << std::fixed;
+		output.precision(3);
+
+		output << "{ \"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+
+		bool is_first = true;
+
+		for (int thread_id = 0; thread_id < buffers.size(); thread_id++)
+		{
+			const auto & buffer = buffers[thread_id];
+
+			output 
+				<< (is_first ? "\n" : ",\n")
+				<< "{ \"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << thread_id 
+				<< ", \"args\": { \"name\": \"thread " << thread_id << "\" } }";
+
+			is_first = false;
+
+			// Writes the oldest kept event first
+			long long first = std::max(0LL, buffer.written_count - capacity);
+
+			for (long long index = first; index < buffer.written_count; index++)
+			{
+				const auto & event = buffer.events[index % capacity];
+
+				output 
+					<< ",\n{ \"name\": \"grow\", \"ph\": \"X\", \"pid\": 1, \"tid\": " << thread_id 
+					<< ", \"ts\": " << event.begin_time / 1000.0 
+					<< ", \"dur\": " << (event.end_time - event.begin_time) / 1000.0 
+					<< ", \"args\": { \"subset\": " << event.subset_size << ", \"depth\": " << event.depth << " } }";
+			}
+		}
+
+		output << "\n] }\n";
+
+		return !output.fail();
+	}
+}
\ No newline at end of file
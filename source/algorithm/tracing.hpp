@@ -0,0 +1,69 @@
+#pragma once
+
+// standard
+#include <string>
+#include <vector>
+#include <chrono>
+
+namespace quick_hull 
+{
+	// Execution of a single [ grow ] task
+	struct Trace_Event
+	{
+		public: // fields
+			long long begin_time; // ..nanoseconds since the trace start
+			long long end_time;
+			int       subset_size;
+			int       depth;
+	};
+
+
+	// Per-thread ring buffer, only the owner thread writes into it (so no locking is needed)
+	struct Trace_Thread_Buffer
+	{
+		public: // fields
+			std::vector<Trace_Event> events;
+			long long                written_count; // ..older events are overwritten when the buffer is full
+			char                     padding[64];   // ..keeps counters of neighbour threads on different cache lines
+	};
+
+
+	// Records [ grow ] tasks of each thread and exports them as Chrome trace JSON (viewable in Perfetto)
+	struct Task_Trace
+	{
+		private: // fields
+			std::vector<Trace_Thread_Buffer>      buffers;
+			int                                   capacity;
+			std::chrono::steady_clock::time_point start_time;
+
+		public: // constructors
+			Task_Trace(int capacity_per_thread = 1 << 16);
+
+		public: // methods
+			// Clears events and prepares a buffer for each thread
+			void reset(int thread_count);
+
+			long long get_time() const
+			{
+				return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_time).count();
+			}
+
+			void record(int thread_id, long long begin_time, long long end_time, int subset_size, int depth)
+			{
+				auto & buffer = buffers[thread_id];
+				auto & event = buffer.events[buffer.written_count % capacity];
+
+				event.begin_time  = begin_time;
+				event.end_time    = end_time;
+				event.subset_size = subset_size;
+				event.depth       = depth;
+
+				buffer.written_count++;
+			}
+
+			long long get_dropped_event_count() const;
+
+			// Returns false when the file could not be written
+			bool write_chrome_trace(const std::string & filepath) const;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,303 @@
+// standard
+#include <cmath>
+#include <cfloat>
+#include <sstream>
+#include <algorithm>
+
+// internal
+#include "predicates.hpp"
+#include "algorithm/validation.hpp"
+
+namespace quick_hull 
+{
+	// Hulls up to this size are tested against all edges with SIMD, larger ones by binary search
+	static const int brute_force_hull_size = 64;
+
+
+	// Returns -1 when the point C is on the right side of the AB line, 1 when on the left side and 0 when collinear
+	static inline int get_side(const Vector2 & a, const Vector2 & b, const Vector2 & c)
+	{
+		double orientation = predicates::orientation(a, b, c);
+
+		return (orientation > 0) - (orientation < 0);
+	}
+
+	// Tests a point against a counter-clockwise convex polygon in O(log h) by finding its wedge around the first vertex
+	static inline bool is_outside_convex_polygon(const std::vector<Vector2> & polygon, const Vector2 & point)
+	{
+		int count = polygon.size();
+		const auto & origin = polygon[0];
+
+		// ..the point is on the outer side of the first or the last edge
+		if (get_side(origin, polygon[1], point) < 0) return true;
+		if (get_side(origin, polygon[count - 1], point) > 0) return true;
+
+		// Finds the last vertex I, so the point is not on the right side of the (origin, I) ray
+		int low = 1, high = count - 1;
+
+		while (high - low > 1)
+		{
+			int middle = (low + high) / 2;
+
+			if (get_side(origin, polygon[middle], point) >= 0) low = middle;
+			else high = middle;
+		}
+
+		return get_side(polygon[low], polygon[low + 1], point) < 0;
+	}
+
+
+	Hull_Validation_Result validate_convex_hull
+	(
+		const std::vector<Vector2> & convex_hull, 
+		const Point_Buffer & points
+	)
+	{
+		Hull_Validation_Result result = { true, std::string(), 0 };
+
+		int hull_count = convex_hull.size();
+		int point_count = points.size();
+
+		// Degenerate hulls: repeated vertices are collapsed, then all points have to be the single vertex or lie on the segment
+		std::vector<Vector2> distinct_vertices;
+
+		for (const auto & vertex : convex_hull)
+		{
+			if (distinct_vertices.empty() || vertex != distinct_vertices.back()) distinct_vertices.push_back(vertex);
+		}
+
+		while (distinct_vertices.size() > 1 && distinct_vertices.front() == distinct_vertices.back()) distinct_vertices.pop_back();
+
+		if (distinct_vertices.size() < 3) 
+		{
+			if (distinct_vertices.empty()) 
+			{
+				result.is_valid = point_count == 0;
+				result.error = result.is_valid ? std::string() : "convex hull is empty";
+				result.outside_point_count = point_count;
+				return result;
+			}
+
+			const auto a = distinct_vertices.front();
+			const auto b = distinct_vertices.back();
+			long long outside_point_count = 0;
+
+			#pragma omp parallel for reduction(+:outside_point_count)
+			for (int index = 0; index < point_count; index++)
+			{
+				const auto & point = points[index];
+
+				bool is_on_segment = get_side(a, b, point) == 0 
+					&& std::min(a.x, b.x) <= point.x && point.x <= std::max(a.x, b.x) 
+					&& std::min(a.y, b.y) <= point.y && point.y <= std::max(a.y, b.y);
+
+				outside_point_count += !is_on_segment;
+			}
+
+			if (outside_point_count > 0)
+			{
+				std::ostringstream error;
+				error << outside_point_count << " points are off the degenerate convex hull (a point or a segment)";
+
+				result.is_valid = false;
+				result.error = error.str();
+				result.outside_point_count = outside_point_count;
+			}
+
+			return result;
+		}
+
+		// 1. Checks each vertex to be a strict counter-clockwise turn and the hull to turn around once
+		long long bad_turn_count = 0;
+		double total_turn = 0;
+
+		#pragma omp parallel for reduction(+:bad_turn_count, total_turn)
+		for (int index = 0; index < hull_count; index++)
+		{
+			const auto & a = convex_hull[index];
+			const auto & b = convex_hull[(index + 1) % hull_count];
+			const auto & c = convex_hull[(index + 2) % hull_count];
+
+			if (get_side(a, b, c) <= 0) bad_turn_count++;
+
+			double ab_x = b.x - a.x, ab_y = b.y - a.y;
+			double bc_x = c.x - b.x, bc_y = c.y - b.y;
+
+			total_turn += std::atan2(ab_x * bc_y - ab_y * bc_x, ab_x * bc_x + ab_y * bc_y);
+		}
+
+		if (bad_turn_count > 0)
+		{
+			std::ostringstream error;
+			error << bad_turn_count << " vertices are not strictly convex counter-clockwise turns";
+
+			result.is_valid = false;
+			result.error = error.str();
+			return result;
+		}
+
+		if (std::fabs(total_turn - 2 * M_PI) > 1e-6) 
+		{
+			result.is_valid = false;
+			result.error = "convex hull is not a simple polygon";
+			return result;
+		}
+
+		// 2. Checks every point to be inside or on the boundary of the hull
+		long long outside_point_count = 0;
+
+		if (hull_count <= brute_force_hull_size) 
+		{
+			// Edges as structure of arrays for SIMD
+			double edge_start_x[brute_force_hull_size], edge_start_y[brute_force_hull_size];
+			double edge_delta_x[brute_force_hull_size], edge_delta_y[brute_force_hull_size];
+
+			for (int edge = 0; edge < hull_count; edge++)
+			{
+				const auto & a = convex_hull[edge];
+				const auto & b = convex_hull[(edge + 1) % hull_count];
+
+				edge_start_x[edge] = a.x;
+				edge_start_y[edge] = a.y;
+				edge_delta_x[edge] = b.x - a.x;
+				edge_delta_y[edge] = b.y - a.y;
+			}
+
+			#pragma omp parallel for reduction(+:outside_point_count)
+			for (int index = 0; index < point_count; index++)
+			{
+				const double point_x = points[index].x;
+				const double point_y = points[index].y;
+				int is_outside = 0;
+				int is_uncertain = 0;
+
+				// Filtered orientation against every edge
+				#pragma omp simd reduction(|:is_outside, is_uncertain)
+				for (int edge = 0; edge < hull_count; edge++)
+				{
+					double left  = edge_delta_x[edge] * (point_y - edge_start_y[edge]);
+					double right = edge_delta_y[edge] * (point_x - edge_start_x[edge]);
+					double bound = predicates::orientation_error_bound * (std::fabs(left) + std::fabs(right));
+
+					is_outside   |= (left - right) < -bound;
+					is_uncertain |= std::fabs(left - right) <= bound;
+				}
+
+				// Nearly collinear points are rechecked with the exact predicate
+				if (!is_outside && is_uncertain)
+				{
+					for (int edge = 0; edge < hull_count; edge++)
+					{
+						if (get_side(convex_hull[edge], convex_hull[(edge + 1) % hull_count], points[index]) < 0) 
+						{
+							is_outside = 1;
+							break;
+						}
+					}
+				}
+
+				outside_point_count += is_outside;
+			}
+		}
+		else 
+		{
+			#pragma omp parallel for reduction(+:outside_point_count)
+			for (int index = 0; index < point_count; index++)
+			{
+				outside_point_count += is_outside_convex_polygon(convex_hull, points[index]);
+			}
+		}
+
+		if (outside_point_count > 0)
+		{
+			std::ostringstream error;
+			error << outside_point_count << " points are outside of the convex hull";
+
+			result.is_valid = false;
+			result.error = error.str();
+			result.outside_point_count = outside_point_count;
+		}
+
+		return result;
+	}
+
+
+	Hull_Validation_Result validate_convex_layers
+	(
+		const Convex_Layers & layers, 
+		const Point_Buffer & points
+	)
+	{
+		Hull_Validation_Result result = { true, std::string(), 0 };
+
+		// 1. Compares the layer vertices and the points as sorted multisets
+		auto is_before = [](const Vector2 & a, const Vector2 & b) { return a.x < b.x || (a.x == b.x && a.y < b.y); };
+
+		std::vector<Vector2> sorted_vertices(layers.vertices.begin(), layers.vertices.end());
+		std::vector<Vector2> sorted_points(points.begin(), points.end());
+
+		std::sort(sorted_vertices.begin(), sorted_vertices.end(), is_before);
+		std::sort(sorted_points.begin(), sorted_points.end(), is_before);
+
+		if (sorted_vertices != sorted_points) 
+		{
+			result.is_valid = false;
+			result.error = "layers do not hold each point exactly once";
+			return result;
+		}
+
+		// 2. Checks each layer against the next one (containment is transitive over the nested layers)
+		for (int layer = 0; layer < layers.get_layer_count(); layer++)
+		{
+			std::vector<Vector2> vertices(layers.vertices.begin() + layers.offsets[layer], layers.vertices.begin() + layers.offsets[layer + 1]);
+
+			Point_Buffer next_vertices;
+			if (layer + 1 < layers.get_layer_count()) 
+			{
+				next_vertices.assign(layers.vertices.begin() + layers.offsets[layer + 1], layers.vertices.begin() + layers.offsets[layer + 2]);
+			}
+
+			// ..degenerate layers (a point or a segment) hold all deeper points on them
+			if (vertices.size() < 3) 
+			{
+				bool is_degenerate_valid = !vertices.empty();
+
+				for (const auto & point : next_vertices) 
+				{
+					const auto & a = vertices.front();
+					const auto & b = vertices.back();
+
+					is_degenerate_valid = is_degenerate_valid && get_side(a, b, point) == 0 
+						&& std::min(a.x, b.x) <= point.x && point.x <= std::max(a.x, b.x) 
+						&& std::min(a.y, b.y) <= point.y && point.y <= std::max(a.y, b.y);
+				}
+
+				if (!is_degenerate_valid) 
+				{
+					std::ostringstream error;
+					error << "degenerate layer " << layer << " does not hold the next layer";
+
+					result.is_valid = false;
+					result.error = error.str();
+					return result;
+				}
+
+				continue;
+			}
+
+			auto layer_result = validate_convex_hull(vertices, next_vertices);
+
+			if (!layer_result.is_valid) 
+			{
+				std::ostringstream error;
+				error << "layer " << layer << ": " << layer_result.error;
+
+				result = layer_result;
+				result.error = error.str();
+				return result;
+			}
+		}
+
+		return result;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,36 @@
+#pragma once
+
+// standard
+#include <string>
+#include <vector>
+
+// internal
+#include "core.hpp"
+#include "./convex_layers.hpp"
+
+namespace quick_hull 
+{
+	struct Hull_Validation_Result
+	{
+		public: // fields
+			bool        is_valid;
+			std::string error;               // ..describes the first failed check
+			long long   outside_point_count; // ..input points found outside of the convex hull
+	};
+
+	// Checks (in parallel) that the convex hull is strictly convex, 
+	// counter-clockwise and contains every given point (a hull of one or two distinct vertices has to hold all points on it)
+	extern Hull_Validation_Result validate_convex_hull
+	(
+		const std::vector<Vector2> & convex_hull, 
+		const Point_Buffer & points
+	);
+
+	// Checks that the layers hold each point once, each layer is strictly convex counter-clockwise and contains the next one
+	// (so each layer is the hull of the points on it and deeper)
+	extern Hull_Validation_Result validate_convex_layers
+	(
+		const Convex_Layers & layers, 
+		const Point_Buffer & points
+	);
+}
\ No newline at end of file
@@ -0,0 +1,184 @@
+// standard
+#include <atomic>
+#include <fstream>
+#include <sstream>
+#include <cstdint>
+
+// external
+#if __linux__
+	#include <sys/mman.h>
+#endif
+
+// internal
+#include "allocation.hpp"
+
+// Large buffers are aligned for cache lines when huge pages are off
+static const size_t cache_line_size = 64;
+
+// Placed right before a large buffer
+struct Large_Buffer_Header 
+{
+	void * block;
+	size_t mapped_size; // ..zero for blocks of the operator new
+};
+
+static std::atomic<int> huge_page_mode((int)Huge_Page_Mode::Off);
+
+static std::atomic<long long> buffer_count(0);
+static std::atomic<long long> advised_buffer_count(0);
+static std::atomic<long long> explicit_buffer_count(0);
+static std::atomic<long long> fallback_count(0);
+
+
+static inline uintptr_t round_up(uintptr_t value, uintptr_t alignment)
+{
+	return (value + alignment - 1) / alignment * alignment;
+}
+
+static void * place_large_buffer(void * block, size_t mapped_size, size_t alignment)
+{
+	uintptr_t buffer = round_up((uintptr_t)block + sizeof(Large_Buffer_Header), alignment);
+
+	auto * header = reinterpret_cast<Large_Buffer_Header *>(buffer - sizeof(Large_Buffer_Header));
+	header->block       = block;
+	header->mapped_size = mapped_size;
+
+	return (void *)buffer;
+}
+
+
+void set_huge_page_mode(Huge_Page_Mode mode)
+{
+	huge_page_mode = (int)mode;
+}
+
+Huge_Page_Mode get_huge_page_mode()
+{
+	return (Huge_Page_Mode)huge_page_mode.load();
+}
+
+Huge_Page_Usage get_huge_page_usage()
+{
+	Huge_Page_Usage usage;
+
+	usage.buffer_count          = buffer_count;
+	usage.advised_buffer_count  = advised_buffer_count;
+	usage.explicit_buffer_count = explicit_buffer_count;
+	usage.fallback_count        = fallback_count;
+	usage.resident_huge_bytes   = -1;
+
+	// ..the kernel sums anonymous huge pages of all mappings
+	std::ifstream input("/proc/self/smaps_rollup");
+	std::string line;
+
+	while (std::getline(input, line))
+	{
+		std::istringstream stream(line);
+		std::string key;
+		long long kilobytes;
+
+		if (stream >> key >> kilobytes && key == "AnonHugePages:") usage.resident_huge_bytes = kilobytes * 1024;
+	}
+
+	return usage;
+}
+
+std::string Huge_Page_Usage::get_text() const
+{
+	std::ostringstream builder;
+
+	builder 
+		<< "{ huge pages: " << get_huge_page_mode_name(get_huge_page_mode()) 
+		<< ", large buffers: " << buffer_count 
+		<< ", advised: " << advised_buffer_count 
+		<< ", explicit: " << explicit_buffer_count 
+		<< ", fallbacks: " << fallback_count 
+		<< ", resident huge: ";
+
+	if (resident_huge_bytes >= 0) builder << resident_huge_bytes / (1 << 20) << " MB";
+	else builder << "unknown";
+
+	builder << " }";
+
+	return builder.str();
+}
+
+
+std::string get_huge_page_mode_name(Huge_Page_Mode mode)
+{
+	switch (mode)
+	{
+		case Huge_Page_Mode::Transparent: return "transparent";
+		case Huge_Page_Mode::Explicit:    return "explicit";
+		default:                          return "off";
+	}
+}
+
+bool try_parse_huge_page_mode(const std::string & name, Huge_Page_Mode & result_mode)
+{
+	if (name == "off")         { result_mode = Huge_Page_Mode::Off;         return true; }
+	if (name == "transparent") { result_mode = Huge_Page_Mode::Transparent; return true; }
+	if (name == "explicit")    { result_mode = Huge_Page_Mode::Explicit;    return true; }
+
+	return false;
+}
+
+
+void * allocate_large_buffer(size_t size)
+{
+	auto mode = get_huge_page_mode();
+
+	buffer_count++;
+
+	if (mode == Huge_Page_Mode::Explicit) 
+	{
+#if __linux__ && defined(MAP_HUGETLB)
+		// ..the header takes the first huge page, so the buffer starts at the second one
+		size_t mapped_size = round_up(size + huge_page_size, huge_page_size);
+		void * block = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+		if (block != MAP_FAILED) 
+		{
+			explicit_buffer_count++;
+			return place_large_buffer(block, mapped_size, huge_page_size);
+		}
+#endif
+		// Falls back to transparent huge pages (no huge pages are reserved or free)
+		fallback_count++;
+		mode = Huge_Page_Mode::Transparent;
+	}
+
+	size_t alignment = mode == Huge_Page_Mode::Off ? cache_line_size : huge_page_size;
+	void * block = ::operator new(size + alignment + sizeof(Large_Buffer_Header));
+	void * buffer = place_large_buffer(block, 0, alignment);
+
+	if (mode == Huge_Page_Mode::Transparent) 
+	{
+#if __linux__ && defined(MADV_HUGEPAGE)
+		// ..only whole huge pages of the buffer are advised
+		size_t advised_size = size / huge_page_size * huge_page_size;
+
+		if (madvise(buffer, advised_size, MADV_HUGEPAGE) == 0) advised_buffer_count++;
+		else fallback_count++;
+#else
+		fallback_count++;
+#endif
+	}
+
+	return buffer;
+}
+
+void deallocate_large_buffer(void * buffer)
+{
+	auto * header = reinterpret_cast<Large_Buffer_Header *>((uintptr_t)buffer - sizeof(Large_Buffer_Header));
+
+	if (header->mapped_size > 0) 
+	{
+#if __linux__
+		munmap(header->block, header->mapped_size);
+#endif
+		return;
+	}
+
+	::operator delete(header->block);
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+#pragma once
+
+// standard
+#include <memory>
+#include <new>
+#include <string>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+// Page backing of large buffers
+enum class Huge_Page_Mode 
+{
+	Off,
+	Transparent, // ..aligned to the huge page and advised to the kernel (MADV_HUGEPAGE)
+	Explicit     // ..mapped from the reserved huge pages (MAP_HUGETLB), transparent when none are free
+};
+
+// Buffers from this size are allocated aligned (to the huge page when huge pages are enabled)
+static const size_t large_buffer_size = 4 << 20;
+static const size_t huge_page_size    = 2 << 20;
+
+
+// Counters of large buffers allocated since the start
+struct Huge_Page_Usage 
+{
+	public: // fields
+		long long buffer_count;          // ..large buffers
+		long long advised_buffer_count;  // ..backed by transparent huge pages
+		long long explicit_buffer_count; // ..backed by reserved huge pages
+		long long fallback_count;        // ..requested huge pages, which were unavailable
+		long long resident_huge_bytes;   // ..process-wide resident anonymous huge pages (-1 when unknown)
+
+	public: // methods
+		std::string get_text() const;
+};
+
+
+extern void set_huge_page_mode(Huge_Page_Mode mode);
+extern Huge_Page_Mode get_huge_page_mode();
+extern Huge_Page_Usage get_huge_page_usage();
+
+extern std::string get_huge_page_mode_name(Huge_Page_Mode mode);
+extern bool try_parse_huge_page_mode(const std::string & name, Huge_Page_Mode & result_mode);
+
+// Allocates a buffer of at least [ large_buffer_size ] bytes with the backing of the current mode
+extern void * allocate_large_buffer(size_t size);
+extern void deallocate_large_buffer(void * buffer);
+
+
+// Allocator, which default-initializes elements on resize (so trivial elements stay uninitialized). 
+// Pages of a large buffer are then first touched by the threads writing into them, which places them on their NUMA nodes.
+// Large buffers (repeatedly scanned points) are aligned and may be backed by huge pages, which cuts TLB misses of the scans.
+template <typename T>
+struct Default_Init_Allocator : public std::allocator<T>
+{
+	public: // types
+		template <typename U> 
+		struct rebind { typedef Default_Init_Allocator<U> other; };
+
+	public: // constructors
+		Default_Init_Allocator() noexcept { }
+		template <typename U> 
+		Default_Init_Allocator(const Default_Init_Allocator<U> &) noexcept { }
+
+	public: // methods
+		T * allocate(size_t count)
+		{
+			if (count * sizeof(T) >= large_buffer_size) return static_cast<T *>(allocate_large_buffer(count * sizeof(T)));
+
+			return std::allocator<T>::allocate(count);
+		}
+
+		// ..the size selects the same path as the allocation
+		void deallocate(T * pointer, size_t count)
+		{
+			if (count * sizeof(T) >= large_buffer_size) deallocate_large_buffer(pointer);
+			else std::allocator<T>::deallocate(pointer, count);
+		}
+
+		template <typename U>
+		void construct(U * pointer) noexcept(std::is_nothrow_default_constructible<U>::value)
+		{
+			::new (static_cast<void *>(pointer)) U;
+		}
+
+		template <typename U, typename... Arguments>
+		void construct(U * pointer, Arguments &&... arguments)
+		{
+			::new (static_cast<void *>(pointer)) U(std::forward<Arguments>(arguments)...);
+		}
+};
\ No newline at end of file
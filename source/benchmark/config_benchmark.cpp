@@ -0,0 +1,521 @@
+// standard
+#include <chrono>
+#include <thread>
+#include <fstream>
+
+// internal
+#include "allocation.hpp"
+#include "console.hpp"
+#include "performance_counters.hpp"
+#include "algorithm/kernels.hpp"
+#include "algorithm/sequential.hpp"
+#include "algorithm/openmp.hpp"
+#include "algorithm/mixed_precision.hpp"
+#include "algorithm/job_executor.hpp"
+#include "program/config_generation_method.hpp"
+#include "./constants.hpp"
+#include "./config_benchmark.hpp"
+
+// external
+#include "omp.h"
+
+#if __NVCC__
+	#include "algorithm/cuda.hpp"
+#endif
+
+
+namespace benchmark 
+{
+	// Points of each interactive job measured by the job executor
+	static const int interactive_job_size = 1000;
+
+
+	double Benchmark_Case_Result::get_throughput() const
+	{
+		if (statistics.median <= 0) return 0;
+
+		return (double)point_count * tenant_count / (statistics.median / 1000.0);
+	}
+
+
+	bool Configuration_Benchmark::try_initialize
+	(
+		program::Input_Configuration input, 
+		bool allow_panic
+	)
+	{
+		// * Sets defaults
+
+		this->engines = { "sequential", "openmp" };
+		this->thread_counts = { omp_get_max_threads() };
+		this->tenant_count  = 1;
+		this->interactive_job_count = 0;
+#if __NVCC__
+		this->engines.push_back("cuda");
+#endif
+		this->distributions    = { "disk" };
+		this->sizes            = { 1000000 };
+		this->warmup_count     = 1;
+		this->repetition_count = 10;
+		this->seed             = 1;
+		this->is_capturing_counters = false;
+
+		// * Looks at input
+
+		for (auto iterator = program::Input_Configuration_Iterator(input); iterator.move_next();) 
+		{
+			if (iterator.is_argument(benchmark_arguments_tag::help)) 
+			{
+				benchmark::print_help();
+				exit(EXIT_SUCCESS);
+			}
+			else
+			if (iterator.is_argument(benchmark_arguments_tag::engines)) 
+			{
+				if (iterator.move_next()) this->engines = iterator.get_argument_as_list();
+				else if (allow_panic) program::panic_begin << "Panic: benchmark engines are undefined!" << program::panic_end;
+			}
+			else
+			if (iterator.is_argument(benchmark_arguments_tag::distributions)) 
+			{
+				if (iterator.move_next()) this->distributions = iterator.get_argument_as_list();
+				else if (allow_panic) program::panic_begin << "Panic: benchmark distributions are undefined!" << program::panic_end;
+			}
+			else
+			if (iterator.is_argument(benchmark_arguments_tag::sizes)) 
+			{
+				if (iterator.move_next()) this->sizes = iterator.get_argument_as_int_list();
+				else if (allow_panic) program::panic_begin << "Panic: benchmark sizes are undefined!" << program::panic_end;
+			}
+			else
+			if (iterator.is_argument(benchmark_arguments_tag::threads)) 
+			{
+				if (iterator.move_next()) this->thread_counts = iterator.get_argument_as_int_list();
+				else if (allow_panic) program::panic_begin << "Panic: benchmark thread counts are undefined!" << program::panic_end;
+			}
+			else
+			if (iterator.is_argument(benchmark_arguments_tag::tenants)) 
+			{
+				if (iterator.move_next()) this->tenant_count = iterator.get_argument_as_int();
+				else if (allow_panic) program::panic_begin << "Panic: benchmark tenant count is undefined!" << program::panic_end;
+			}
+			else
+			if (iterator.is_argument(benchmark_arguments_tag::interactive_jobs)) 
+			{
+				if (iterator.move_next()) this->interactive_job_count = iterator.get_argument_as_int();
+				else if (allow_panic) program::panic_begin << "Panic: benchmark interactive job count is undefined!" << program::panic_end;
+			}
+			else
+			if (iterator.is_argument(benchmark_arguments_tag::warmup)) 
+			{
+				if (iterator.move_next()) this->warmup_count = iterator.get_argument_as_int();
+				else if (allow_panic) program::panic_begin << "Panic: benchmark warmup count is undefined!" << program::panic_end;
+			}
+			else
+			if (iterator.is_argument(benchmark_arguments_tag::repetitions)) 
+			{
+				if (iterator.move_next()) this->repetition_count = iterator.get_argument_as_int();
+				else if (allow_panic) program::panic_begin << "Panic: benchmark repetition count is undefined!" << program::panic_end;
+			}
+			else
+			if (iterator.is_argument(benchmark_arguments_tag::seed)) 
+			{
+				if (iterator.move_next()) this->seed = iterator.get_argument_as_int();
+				else if (allow_panic) program::panic_begin << "Panic: benchmark seed is undefined!" << program::panic_end;
+			}
+			else
+			if (iterator.is_argument(benchmark_arguments_tag::perf_counters)) 
+			{
+				this->is_capturing_counters = true;
+			}
+			else
+			if (iterator.is_argument(benchmark_arguments_tag::kernel_isa)) 
+			{
+				quick_hull::Kernel_Isa isa;
+
+				if (!iterator.move_next()) 
+				{
+					if (allow_panic) program::panic_begin << "Panic: benchmark kernel instruction set is undefined!" << program::panic_end;
+				}
+				else if (!quick_hull::try_parse_kernel_isa(iterator.get_argument_as_string(), isa) || !quick_hull::set_kernel_isa(isa)) 
+				{
+					if (allow_panic) program::panic_begin << "Panic: kernel instruction set is not supported: " << iterator.get_argument_as_string() << "." << program::panic_end;
+				}
+			}
+			else
+			if (iterator.is_argument(benchmark_arguments_tag::huge_pages)) 
+			{
+				Huge_Page_Mode mode;
+
+				if (!iterator.move_next()) 
+				{
+					if (allow_panic) program::panic_begin << "Panic: benchmark huge pages mode is undefined!" << program::panic_end;
+				}
+				else if (!try_parse_huge_page_mode(iterator.get_argument_as_string(), mode)) 
+				{
+					if (allow_panic) program::panic_begin << "Panic: unknown huge pages mode: " << iterator.get_argument_as_string() << "." << program::panic_end;
+				}
+				else set_huge_page_mode(mode);
+			}
+			else
+			if (iterator.is_argument(benchmark_arguments_tag::output)) 
+			{
+				if (iterator.move_next()) this->output_filepath = iterator.get_argument_as_string();
+				else if (allow_panic) program::panic_begin << "Panic: benchmark output filepath is undefined!" << program::panic_end;
+			}
+		}
+
+		if (this->repetition_count < 1 || this->warmup_count < 0) 
+		{
+			if (allow_panic) program::panic_begin << "Panic: benchmark repetition count must be positive!" << program::panic_end;
+			return false;
+		}
+
+		if (this->tenant_count < 1) 
+		{
+			if (allow_panic) program::panic_begin << "Panic: benchmark tenant count must be positive!" << program::panic_end;
+			return false;
+		}
+
+		if (this->interactive_job_count < 0) 
+		{
+			if (allow_panic) program::panic_begin << "Panic: benchmark interactive job count must not be negative!" << program::panic_end;
+			return false;
+		}
+
+		return true;
+	}
+
+
+	quick_hull::Algorithm * Configuration_Benchmark::create_engine
+	(
+		const std::string & engine, 
+		int thread_count
+	) 
+	const
+	{
+		// Float32 filtered version of any engine
+		const std::string mixed_precision_prefix = "mixed-";
+
+		if (engine.compare(0, mixed_precision_prefix.size(), mixed_precision_prefix) == 0) 
+		{
+			auto * refinement = create_engine(engine.substr(mixed_precision_prefix.size()), thread_count);
+
+			return refinement != nullptr ? new quick_hull::Algorithm_Mixed_Precision(refinement, true, thread_count) : nullptr;
+		}
+
+		if (engine == "sequential") 
+		{
+			return new quick_hull::Algorithm_Sequential();
+		}
+		if (engine == "openmp") 
+		{
+			return new quick_hull::Algorithm_OpenMP(false, thread_count);
+		}
+#if __NVCC__
+		if (engine == "cuda") 
+		{
+			return new quick_hull::Algorithm_Cuda(4); // x16 blocks
+		}
+#endif
+		return nullptr;
+	}
+
+
+	void Configuration_Benchmark::generate_points
+	(
+		const std::string    & distribution, 
+		int                    count, 
+		Point_Buffer & result
+	) 
+	const
+	{
+		double inner_radius;
+
+		if (distribution == "disk")        inner_radius = 0.0; // ..uniform, small convex hull
+		else if (distribution == "ring")   inner_radius = 0.9; // ..thin annulus
+		else if (distribution == "circle") inner_radius = 1.0; // ..all points on the convex hull
+		else 
+		{
+			program::panic_begin << "Panic: unknown benchmark distribution: " << distribution << "." << program::panic_end;
+			return;
+		}
+
+		points_generation::Configuration_Generation_Circle(Vector2(0, 0), 1.0, inner_radius, seed)
+			.execute(result, count);
+	}
+
+
+	Benchmark_Case_Result Configuration_Benchmark::measure
+	(
+		const std::vector<quick_hull::Algorithm *> & engines, 
+		const Point_Buffer                         & points,
+		int                                          thread_count
+	) 
+	const
+	{
+		Benchmark_Case_Result result;
+		std::vector<std::vector<double>> tenant_samples(engines.size());
+		program::Hardware_Counters_Session counters;
+
+		result.point_count  = points.size();
+		result.tenant_count = engines.size();
+
+		// ..warmup runs are not measured (tenants warm up one after another)
+		for (auto * engine : engines)
+		{
+			for (int run = 0; run < warmup_count; run++) delete engine->run(points);
+		}
+
+		// ..each instance owns its thread count, so concurrent runs do not share the Open MP setting
+		auto run_tenant = [&](int tenant) 
+		{
+			for (int run = 0; run < repetition_count; run++)
+			{
+				auto stopwatch_start = std::chrono::steady_clock::now();
+
+				auto * convex_hull = engines[tenant]->run(points);
+
+				auto stopwatch_end = std::chrono::steady_clock::now();
+
+				if (tenant == 0) result.convex_hull_count = convex_hull->size();
+				delete convex_hull;
+
+				tenant_samples[tenant].push_back(std::chrono::duration<double, std::milli>(stopwatch_end - stopwatch_start).count());
+			}
+		};
+
+		if (is_capturing_counters) counters.start(thread_count);
+
+		std::vector<std::thread> tenant_threads;
+		for (int tenant = 1; tenant < engines.size(); tenant++) tenant_threads.emplace_back(run_tenant, tenant);
+
+		run_tenant(0);
+
+		for (auto & thread : tenant_threads) thread.join();
+
+		if (is_capturing_counters) 
+		{
+			counters.stop();
+			result.counters_json = counters.get_json();
+		}
+
+		std::vector<double> samples;
+		for (const auto & samples_of_tenant : tenant_samples) samples.insert(samples.end(), samples_of_tenant.begin(), samples_of_tenant.end());
+
+		result.statistics = program::compute_measurement_statistics(samples);
+
+		return result;
+	}
+
+
+	std::vector<Benchmark_Case_Result> Configuration_Benchmark::measure_jobs
+	(
+		const std::string  & distribution, 
+		const Point_Buffer & points
+	) 
+	const
+	{
+		std::vector<double> batch_samples;
+		std::vector<double> interactive_samples;
+		int batch_hull_count = 0;
+		int interactive_hull_count = 0;
+		int yield_count = 0;
+
+		Point_Buffer interactive_points;
+		generate_points(distribution, interactive_job_size, interactive_points);
+
+		quick_hull::Job_Executor executor(tenant_count);
+
+		for (int run = 0; run < repetition_count; run++)
+		{
+			std::vector<std::future<quick_hull::Job_Result>> batch_futures;
+
+			for (int tenant = 0; tenant < tenant_count; tenant++) 
+			{
+				batch_futures.push_back(executor.submit(Point_Buffer(points)));
+			}
+
+			// ..each interactive job is submitted after the previous one is done, while the batch jobs keep the workers busy
+			for (int job = 0; job < interactive_job_count; job++)
+			{
+				auto result = executor.submit(Point_Buffer(interactive_points), quick_hull::Job_Options(quick_hull::Job_Priority::Interactive)).get();
+
+				interactive_samples.push_back(result.queue_milliseconds + result.run_milliseconds);
+				interactive_hull_count = result.convex_hull.size();
+			}
+
+			for (auto & future : batch_futures)
+			{
+				auto result = future.get();
+
+				batch_samples.push_back(result.run_milliseconds);
+				batch_hull_count = result.convex_hull.size();
+				yield_count     += result.yield_count;
+			}
+		}
+
+		std::vector<Benchmark_Case_Result> results(2);
+
+		results[0].engine            = "executor-batch";
+		results[0].point_count       = points.size();
+		results[0].convex_hull_count = batch_hull_count;
+		results[0].statistics        = program::compute_measurement_statistics(batch_samples);
+
+		results[1].engine            = "executor-interactive";
+		results[1].point_count       = interactive_points.size();
+		results[1].convex_hull_count = interactive_hull_count;
+		results[1].statistics        = program::compute_measurement_statistics(interactive_samples);
+
+		for (auto & result : results)
+		{
+			result.distribution = distribution;
+			result.thread_count = 1;
+			result.tenant_count = tenant_count;
+
+			program::log_begin
+				<< result.engine << " { workers: " << tenant_count << ", interactive jobs: " << interactive_job_count << " }"
+				<< " " << distribution << " x" << result.point_count
+				<< " -> hull: " << result.convex_hull_count 
+				<< ", min: " << result.statistics.min 
+				<< ", median: " << result.statistics.median 
+				<< ", p95: " << result.statistics.p95 
+				<< ", max: " << result.statistics.max << " ms."
+				<< program::log_end;
+		}
+
+		// ..the other interactive jobs were taken by idle workers
+		program::log_begin
+			<< "executor -> interactive jobs run by batch jobs between their grow frames: " 
+			<< yield_count << " of " << interactive_job_count * repetition_count << "."
+			<< program::log_end;
+
+		return results;
+	}
+
+
+	void Configuration_Benchmark::execute() const
+	{
+		std::vector<Benchmark_Case_Result> results;
+
+		for (const auto & distribution : distributions)
+		for (const auto size : sizes)
+		{
+			Point_Buffer points;
+			generate_points(distribution, size, points);
+
+			for (const auto & engine_name : engines)
+			{
+				// Only parallel engines are measured for each thread count
+				bool is_parallel = engine_name == "openmp" || engine_name == "mixed-openmp";
+				int case_count = is_parallel ? thread_counts.size() : 1;
+
+				for (int case_index = 0; case_index < case_count; case_index++)
+				{
+					int thread_count = is_parallel ? thread_counts[case_index] : 1;
+					std::vector<quick_hull::Algorithm *> tenant_engines;
+
+					for (int tenant = 0; tenant < tenant_count; tenant++) 
+					{
+						auto * engine = create_engine(engine_name, thread_count);
+
+						if (engine == nullptr) 
+						{
+							program::panic_begin << "Panic: benchmark engine is not available: " << engine_name << "." << program::panic_end;
+						}
+
+						tenant_engines.push_back(engine);
+					}
+
+					auto result = measure(tenant_engines, points, thread_count);
+					
+					result.engine       = engine_name;
+					result.distribution = distribution;
+					result.thread_count = thread_count;
+
+					program::log_begin
+						<< engine_name << " { threads: " << thread_count << ", tenants: " << tenant_count << " }"
+						<< " " << distribution << " x" << size
+						<< " -> hull: " << result.convex_hull_count 
+						<< ", min: " << result.statistics.min 
+						<< ", median: " << result.statistics.median 
+						<< ", p95: " << result.statistics.p95 
+						<< ", max: " << result.statistics.max << " ms"
+						<< ", throughput: " << result.get_throughput() << " points/s."
+						<< program::log_end;
+
+					results.push_back(result);
+
+					for (auto * engine : tenant_engines) delete engine;
+				}
+			}
+
+			if (interactive_job_count > 0) 
+			{
+				auto job_results = measure_jobs(distribution, points);
+				results.insert(results.end(), job_results.begin(), job_results.end());
+			}
+		}
+
+		if (!output_filepath.empty()) 
+		{
+			write_report(results);
+		}
+	}
+
+
+	void Configuration_Benchmark::write_report(const std::vector<Benchmark_Case_Result> & results) const
+	{
+		std::ofstream output(output_filepath, std::ios::out | std::ios::trunc);
+
+		if (output.fail())
+		{
+			program::panic_begin 
+				<< "Panic: could not open file at path: " << output_filepath << "." 
+				<< program::panic_end;
+		}
+
+		output.precision(12);
+
+		output 
+			<< "{\n"
+			<< "\t\"warmup\": " << warmup_count << ",\n"
+			<< "\t\"repetitions\": " << repetition_count << ",\n"
+			<< "\t\"seed\": " << seed << ",\n"
+			<< "\t\"kernel_isa\": \"" << quick_hull::get_kernel_isa_name(quick_hull::get_kernels().isa) << "\",\n"
+			<< "\t\"huge_pages\": \"" << get_huge_page_mode_name(get_huge_page_mode()) << "\",\n"
+			<< "\t\"results\": [";
+
+		for (int index = 0; index < results.size(); index++)
+		{
+			const auto & result = results[index];
+
+			output 
+				<< (index == 0 ? "\n" : ",\n")
+				<< "\t\t{ "
+				<< "\"engine\": \"" << result.engine << "\", "
+				<< "\"distribution\": \"" << result.distribution << "\", "
+				<< "\"points\": " << result.point_count << ", "
+				<< "\"threads\": " << result.thread_count << ", "
+				<< "\"tenants\": " << result.tenant_count << ", "
+				<< "\"hull\": " << result.convex_hull_count << ", "
+				<< "\"min_ms\": " << result.statistics.min << ", "
+				<< "\"median_ms\": " << result.statistics.median << ", "
+				<< "\"p95_ms\": " << result.statistics.p95 << ", "
+				<< "\"max_ms\": " << result.statistics.max << ", "
+				<< "\"mean_ms\": " << result.statistics.mean << ", "
+				<< "\"throughput_points_per_second\": " << result.get_throughput();
+
+			if (!result.counters_json.empty())
+			{
+				output << ", \"counters\": " << result.counters_json;
+			}
+
+			output << " }";
+		}
+
+		output 
+			<< "\n\t]\n"
+			<< "}\n";
+	}
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+#pragma once
+
+// standard
+#include <string>
+#include <vector>
+
+// internal
+#include "core.hpp"
+#include "measurement.hpp"
+#include "input_configuration.hpp"
+#include "algorithm/base.hpp"
+#include "program/config_base.hpp"
+
+namespace benchmark 
+{
+	// Measured result of one engine, distribution, size and thread count combination (run by each tenant)
+	struct Benchmark_Case_Result
+	{
+		public: // fields
+			std::string                     engine;
+			std::string                     distribution;
+			int                             point_count;
+			int                             thread_count;  // ..of each tenant
+			int                             tenant_count;
+			int                             convex_hull_count;
+			program::Measurement_Statistics statistics;
+			std::string                     counters_json; // ..hardware counters summed over measured runs (if captured)
+
+		public: // getters
+			// Returns amount of points processed per second by all tenants (based on the median time)
+			double get_throughput() const;
+	};
+
+
+	struct Configuration_Benchmark : public program::Configuration_Base
+	{
+		private: // ..fields
+			std::vector<std::string> engines;
+			std::vector<std::string> distributions;
+			std::vector<int>         sizes;
+			std::vector<int>         thread_counts;
+			int                      tenant_count;
+			int                      interactive_job_count; // ..submitted to the job executor while batch jobs run (0: not measured)
+			int                      warmup_count;
+			int                      repetition_count;
+			unsigned int             seed;
+			bool                     is_capturing_counters;
+			std::string              output_filepath;
+
+		public: // ..methods
+			bool try_initialize(program::Input_Configuration input, bool allow_panic) override;
+			void execute() const;
+
+		private: // ..methods
+			// Returns a new engine instance or null pointer when the engine is not compiled in
+			quick_hull::Algorithm * create_engine(const std::string & engine, int thread_count) const;
+
+			void generate_points(const std::string & distribution, int count, Point_Buffer & result) const;
+
+			// Each engine instance (a tenant) runs the points from its own thread, samples of all tenants are measured together
+			Benchmark_Case_Result measure
+			(
+				const std::vector<quick_hull::Algorithm *> & engines, 
+				const Point_Buffer                         & points,
+				int                                          thread_count // ..of each engine (counters are opened for its team)
+			) const;
+
+			// Batch jobs of the points (one per tenant, each on its own worker) run while small interactive jobs are submitted one after another,
+			// returns the batch run times and the interactive latencies (from the submission to the result)
+			std::vector<Benchmark_Case_Result> measure_jobs(const std::string & distribution, const Point_Buffer & points) const;
+
+			void write_report(const std::vector<Benchmark_Case_Result> & results) const;
+	};
+}
\ No newline at end of file
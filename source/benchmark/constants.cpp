@@ -0,0 +1,67 @@
+// standard
+#include <iostream>
+
+// internal
+#include "./constants.hpp"
+
+namespace benchmark 
+{
+	void print_help()
+	{
+		std::cout
+		<< std::endl
+
+		<< '\t' << benchmark_arguments_tag::engines 
+			<< " [list] \t -> " << benchmark_arguments_definition::engines 
+			<< std::endl
+		<< '\t' << benchmark_arguments_tag::distributions 
+			<< " [list] \t -> " << benchmark_arguments_definition::distributions 
+			<< std::endl
+		<< '\t' << benchmark_arguments_tag::sizes 
+			<< " [list] \t -> " << benchmark_arguments_definition::sizes 
+			<< std::endl
+		<< '\t' << benchmark_arguments_tag::threads 
+			<< " [list] \t -> " << benchmark_arguments_definition::threads 
+			<< std::endl
+		<< '\t' << benchmark_arguments_tag::tenants 
+			<< " [positive integer] \t -> " << benchmark_arguments_definition::tenants 
+			<< std::endl
+		<< '\t' << benchmark_arguments_tag::interactive_jobs 
+			<< " [positive integer] \t -> " << benchmark_arguments_definition::interactive_jobs 
+			<< std::endl
+
+		<< '\t' << benchmark_arguments_tag::warmup 
+			<< " [positive integer] \t -> " << benchmark_arguments_definition::warmup 
+			<< std::endl
+		<< '\t' << benchmark_arguments_tag::repetitions 
+			<< " [positive integer] \t -> " << benchmark_arguments_definition::repetitions 
+			<< std::endl
+		<< '\t' << benchmark_arguments_tag::seed 
+			<< " [positive integer] \t -> " << benchmark_arguments_definition::seed 
+			<< std::endl
+		<< '\t' << benchmark_arguments_tag::perf_counters 
+			<< "\t -> " << benchmark_arguments_definition::perf_counters 
+			<< std::endl
+		<< '\t' << benchmark_arguments_tag::kernel_isa 
+			<< " [sse2|avx2|avx512] \t -> " << benchmark_arguments_definition::kernel_isa 
+			<< std::endl
+		<< '\t' << benchmark_arguments_tag::huge_pages 
+			<< " [transparent|explicit|off] \t -> " << benchmark_arguments_definition::huge_pages 
+			<< std::endl
+
+		<< '\t' << benchmark_arguments_tag::output 
+			<< " [path] \t -> " << benchmark_arguments_definition::output 
+			<< std::endl
+
+		<< '\t' << benchmark_arguments_tag::help 
+			<< "\t -> " << benchmark_arguments_definition::help 
+			<< std::endl
+
+		<< "\n\tExamples:"
+		   "\n\t./quickhull_benchmark --engines sequential,openmp --sizes 100000,1000000 --threads 1,2,4 --output report.json"
+		   "\n\t./quickhull_benchmark --distributions disk,circle --repetitions 20"
+			<< std::endl
+
+		<< std::endl;
+	}
+}
\ No newline at end of file
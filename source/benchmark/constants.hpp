@@ -0,0 +1,54 @@
+#pragma once
+
+// internal
+#include <string>
+
+namespace benchmark_arguments_tag 
+{
+	static const std::string help          = "--help";
+
+	// matrix
+	static const std::string engines       = "--engines";
+	static const std::string distributions = "--distributions";
+	static const std::string sizes         = "--sizes";
+	static const std::string threads       = "--threads";
+	static const std::string tenants       = "--tenants";
+	static const std::string interactive_jobs = "--interactive-jobs";
+
+	// measuring
+	static const std::string warmup        = "--warmup";
+	static const std::string repetitions   = "--repetitions";
+	static const std::string seed          = "--seed";
+	static const std::string perf_counters = "--perf-counters";
+	static const std::string kernel_isa    = "--kernel-isa";
+	static const std::string huge_pages    = "--huge-pages";
+
+	// output
+	static const std::string output        = "--output";
+};
+
+namespace benchmark_arguments_definition 
+{
+	static const std::string help          = "Prints this information. [] - compulsory, () - optional parameter value.";
+
+	static const std::string engines       = "Sets engines to measure: sequential, openmp, cuda, or any of them with the mixed- prefix for float32 filtering (default: all compiled in).";
+	static const std::string distributions = "Sets points distributions: disk, ring, circle (default: disk).";
+	static const std::string sizes         = "Sets amounts of points (default: 1000000).";
+	static const std::string threads       = "Sets thread counts of parallel engines (default: maximum).";
+	static const std::string tenants       = "Sets number of engine instances, which run each case concurrently from own threads, each with the thread count of the case (default: 1).";
+	static const std::string interactive_jobs = "Also measures the job executor: one batch job per tenant runs the points of each case, while this many small interactive jobs are submitted one after another (default: 0, off).";
+
+	static const std::string warmup        = "Sets number of unmeasured runs per case (default: 1).";
+	static const std::string repetitions   = "Sets number of measured runs per case (default: 10).";
+	static const std::string seed          = "Sets points generation seed (default: 1).";
+	static const std::string perf_counters = "Captures hardware performance counters over measured runs (Linux only).";
+	static const std::string huge_pages    = "Backs large point buffers by 2 MB pages: transparent or explicit (default: off).";
+	static const std::string kernel_isa    = "Forces kernels of the instruction set: sse2, avx2, avx512 (default: the newest supported by the CPU).";
+
+	static const std::string output        = "Sets filepath of the JSON report.";
+}
+
+namespace benchmark 
+{
+	void print_help();
+}
\ No newline at end of file
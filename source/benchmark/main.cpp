@@ -0,0 +1,13 @@
+// internal
+#include "./config_benchmark.hpp"
+
+
+int main(const int argument_count, const char **arguments) 
+{
+	benchmark::Configuration_Benchmark configuration;
+
+	configuration.try_initialize(program::Input_Configuration(argument_count, arguments), true);
+	configuration.execute();
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+#pragma once
+
+// standard
+#include <deque>
+#include <mutex>
+#include <utility>
+#include <condition_variable>
+
+namespace program
+{
+	// Queue between pipeline stages: the producer waits while it is full, the consumer while it is empty.
+	// After [ close ] the consumer takes the rest of the items and then gets false.
+	template <typename T>
+	struct Bounded_Queue
+	{
+		private: // fields
+			std::deque<T>           items;
+			size_t                  capacity;
+			bool                    is_closed;
+			std::mutex              mutex;
+			std::condition_variable not_full;
+			std::condition_variable not_empty;
+
+		public: // constructors
+			Bounded_Queue(size_t capacity) : capacity(capacity), is_closed(false) { }
+
+		public: // methods
+			void push(T item)
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+
+				not_full.wait(lock, [this] { return items.size() < capacity; });
+				items.push_back(std::move(item));
+
+				not_empty.notify_one();
+			}
+
+			bool pop(T & result_item)
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+
+				not_empty.wait(lock, [this] { return !items.empty() || is_closed; });
+
+				if (items.empty()) return false;
+
+				result_item = std::move(items.front());
+				items.pop_front();
+
+				not_full.notify_one();
+				return true;
+			}
+
+			void close()
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+
+				is_closed = true;
+				not_empty.notify_all();
+			}
+	};
+}
\ No newline at end of file
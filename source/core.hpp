@@ -3,8 +3,16 @@
 // standard
 #include <vector>
 #include <string>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+// internal
+#include "allocation.hpp"
 
 // Program's execution specific code
+// (header-only value type, so engine loops inline and vectorize every operation without LTO)
 struct Vector2
 {
 	public: // fields
@@ -12,28 +20,91 @@ struct Vector2
 		double y;
 
 	public: // methods
-		Vector2(double x, double y);
+		constexpr Vector2(double x, double y) noexcept : x(x), y(y) { }
 		Vector2() = default;
 
 		// Subtracts other vector from this vector
-		Vector2 operator-(const Vector2 &other);
-		Vector2 operator+(const Vector2 &other);
-		Vector2 operator/(const double number);
-		Vector2 operator/=(const double number);
-		bool operator==(const Vector2 &other);
-		bool operator!=(const Vector2 &other);
+		constexpr Vector2 operator-(const Vector2 &other) const noexcept { return Vector2(x - other.x, y - other.y); }
+		constexpr Vector2 operator+(const Vector2 &other) const noexcept { return Vector2(x + other.x, y + other.y); }
+		constexpr Vector2 operator/(const double number) const noexcept { return Vector2(x / number, y / number); }
+		constexpr bool operator==(const Vector2 &other) const noexcept { return x == other.x && y == other.y; }
+		constexpr bool operator!=(const Vector2 &other) const noexcept { return !(*this == other); }
+
+		Vector2 & operator/=(const double number) noexcept 
+		{
+			x /= number;
+			y /= number;
+
+			return *this;
+		}
 
 		// Returns this vector's squared magnitude
-		double get_sqr_magnitude() const;
-		double get_magnitude() const;
-		size_t get_hash() const;
-		Vector2 get_conter_clockwise_normal() const;
-		Vector2 get_normalized() const;
+		constexpr double get_sqr_magnitude() const noexcept { return dot_product(*this, *this); }
+		double get_magnitude() const noexcept { return std::sqrt(get_sqr_magnitude()); }
+
+		size_t get_hash() const noexcept
+		{
+			size_t x_hash = std::hash<double>{}(this->x);
+			size_t y_hash = std::hash<double>{}(this->y);
 
-		void normalize();
+			return x_hash ^ (y_hash << 1);
+		}
+
+		constexpr Vector2 get_conter_clockwise_normal() const noexcept { return Vector2(-y, x); }
+		constexpr Vector2 get_clockwise_normal() const noexcept { return Vector2(y, -x); }
+
+		/// WARNING: could break when magnitude is zero
+		Vector2 get_normalized() const noexcept { return (*this) / get_magnitude(); }
+		void normalize() noexcept { (*this) /= get_magnitude(); }
 
 	public: // static methods
-		static double  sqr_distance(const Vector2 &point_a , const Vector2 &point_b);
-		static double  dot_product (const Vector2 &vector_a, const Vector2 &vector_b);
-		static Vector2 project     (const Vector2 &vector_a, const Vector2 &vector_b); 
-};
\ No newline at end of file
+		static constexpr double sqr_distance(const Vector2 &point_a , const Vector2 &point_b) noexcept
+		{
+			return (point_a - point_b).get_sqr_magnitude();
+		}
+
+		static constexpr double dot_product(const Vector2 &vector_a, const Vector2 &vector_b) noexcept
+		{
+			return (vector_a.x * vector_b.x) + (vector_a.y * vector_b.y); 
+		}
+
+		// Returns z of the 3D cross product: positive when the B vector is counter-clockwise from the A vector
+		static constexpr double cross_product(const Vector2 &vector_a, const Vector2 &vector_b) noexcept
+		{
+			return (vector_a.x * vector_b.y) - (vector_a.y * vector_b.x);
+		}
+
+		// Projects the A vector on the B vector (zero vector when B is zero)
+		static constexpr Vector2 project(const Vector2 &vector_a, const Vector2 &vector_b) noexcept
+		{
+			return vector_b.get_sqr_magnitude() == 0 
+				? Vector2(0, 0) 
+				: Vector2(
+					vector_b.x * (dot_product(vector_a, vector_b) / vector_b.get_sqr_magnitude()), 
+					vector_b.y * (dot_product(vector_a, vector_b) / vector_b.get_sqr_magnitude())
+				);
+		}
+};
+
+
+// Storage of input points and engine scratch buffers (resizing does not touch the memory)
+typedef std::vector<Vector2, Default_Init_Allocator<Vector2>> Point_Buffer;
+
+
+// Compile-time tests
+static_assert(sizeof(Vector2) == 2 * sizeof(double), "Vector2 must be tightly packed (points are copied as raw arrays)");
+static_assert(std::is_trivially_copyable<Vector2>::value, "Vector2 must be trivially copyable");
+static_assert(std::is_standard_layout<Vector2>::value, "Vector2 must have standard layout");
+
+static_assert(Vector2(3, 4) - Vector2(1, 1) == Vector2(2, 3), "subtraction");
+static_assert(Vector2(3, 4) + Vector2(1, 1) != Vector2(3, 4), "addition");
+static_assert(Vector2(3, 4).get_sqr_magnitude() == 25, "squared magnitude");
+static_assert(Vector2::sqr_distance(Vector2(1, 1), Vector2(4, 5)) == 25, "squared distance");
+static_assert(Vector2::dot_product(Vector2(1, 0), Vector2(0, 1)) == 0, "dot product of orthogonal vectors");
+static_assert(Vector2::cross_product(Vector2(1, 0), Vector2(0, 1)) > 0, "counter-clockwise turn is positive");
+static_assert(Vector2::cross_product(Vector2(0, 1), Vector2(1, 0)) < 0, "clockwise turn is negative");
+static_assert(Vector2::cross_product(Vector2(2, 2), Vector2(-1, -1)) == 0, "collinear vectors");
+static_assert(Vector2::cross_product(Vector2(1, 2), Vector2(1, 2).get_conter_clockwise_normal()) > 0, "counter-clockwise normal");
+static_assert(Vector2::cross_product(Vector2(1, 2), Vector2(1, 2).get_clockwise_normal()) < 0, "clockwise normal");
+static_assert(Vector2::project(Vector2(2, 3), Vector2(4, 0)) == Vector2(2, 0), "projection");
+static_assert(Vector2::project(Vector2(2, 3), Vector2(0, 0)) == Vector2(0, 0), "projection on zero vector");
\ No newline at end of file
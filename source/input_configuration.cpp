@@ -1,5 +1,6 @@
 // standard
 #include <cstring>
+#include <sstream>
 
 // internal
 #include "console.hpp"
@@ -81,6 +82,30 @@ namespace program
 		return number;
 	}
 
+	size_t Input_Configuration_Iterator::get_argument_as_size() const 
+	{
+		std::string result;
+		size_t number;
+
+		try 
+		{
+			input.get_string(index, result); 
+			number = std::stoull(result);
+		}
+		catch(const std::exception & exception) 
+		{
+			program::panic_begin << "Parsing arument (" << result << ") to size failed because of.." << exception.what() << "." << panic_end;
+		}
+
+		// ..stoull accepts negative values (wrapped around)
+		if (result.find('-') != std::string::npos) 
+		{
+			program::panic_begin << "Parsing arument (" << result << ") to size failed because of.. negative value." << panic_end;
+		}
+
+		return number;
+	}
+
 	double Input_Configuration_Iterator::get_argument_as_double() const 
 	{
 		std::string result;
@@ -98,4 +123,36 @@ namespace program
 
 		return number;
 	}
+	std::vector<std::string> Input_Configuration_Iterator::get_argument_as_list() const 
+	{
+		std::vector<std::string> result;
+		std::stringstream stream(get_argument_as_string());
+		std::string item;
+
+		while (std::getline(stream, item, ','))
+		{
+			if (!item.empty()) result.push_back(item);
+		}
+
+		return result;
+	}
+
+	std::vector<int> Input_Configuration_Iterator::get_argument_as_int_list() const 
+	{
+		std::vector<int> result;
+
+		for (const auto &item : get_argument_as_list())
+		{
+			try 
+			{
+				result.push_back(std::stoi(item));
+			}
+			catch(std::exception exception) 
+			{
+				program::panic_begin << "Parsing arument (" << item << ") to integer failed because of.." << exception.what() << "." << panic_end;
+			}
+		}
+
+		return result;
+	}
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 // standard
 #include <string>
+#include <vector>
 
 // internal
 #include "console.hpp"
@@ -42,6 +43,10 @@ namespace program
 			bool is_argument(std::string value) const;
 			std::string get_argument_as_string() const;
 			int get_argument_as_int() const;
+			size_t get_argument_as_size() const; // ..a non-negative integer
 			double get_argument_as_double() const;
+			// Splits the argument by commas (e.g. "1,2,4")
+			std::vector<std::string> get_argument_as_list() const;
+			std::vector<int> get_argument_as_int_list() const;
 	};
 }
\ No newline at end of file
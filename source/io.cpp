@@ -1,5 +1,20 @@
 // standard
 #include <fstream>
+#include <sstream>
+#include <iterator>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#if __linux__
+	#include <fcntl.h>
+	#include <unistd.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+#endif
+
+// external
+#include "omp.h"
 
 // internal
 #include "io.hpp"
@@ -7,7 +22,91 @@
 
 namespace program 
 {
-	void read_points(std::string filepath, std::vector<Vector2> & points)
+	// Parses "x y" lines, which start in the [begin, end) byte range of the text, into the result
+	// (the text is followed by a zero byte)
+	static void parse_points(const char * text, size_t text_size, size_t begin, size_t end, Point_Buffer & result)
+	{
+		const char * cursor    = text + begin;
+		const char * range_end = text + end;
+		const char * text_end  = text + text_size;
+
+		// ..a line crossing the range start belongs to the previous range
+		if (begin > 0 && *(cursor - 1) != '\n') 
+		{
+			while (cursor < text_end && *cursor != '\n') cursor++;
+			if (cursor < text_end) cursor++;
+		}
+
+		while (cursor < range_end)
+		{
+			// ..numbers are looked up only on the current line (strtod would skip line ends)
+			while (*cursor == ' ' || *cursor == '\t' || *cursor == '\r') cursor++;
+
+			char * x_end = const_cast<char *>(cursor);
+			double x = *cursor != '\n' ? std::strtod(cursor, &x_end) : 0; // ..blank line
+
+			bool is_parsed = x_end != cursor && *x_end != '\n';
+
+			if (is_parsed) 
+			{
+				char * y_end;
+				double y = std::strtod(x_end, &y_end);
+
+				is_parsed = y_end != x_end;
+
+				if (is_parsed) 
+				{
+					result.push_back(Vector2(x, y));
+					cursor = y_end;
+				}
+			}
+
+			// Moves to the next line
+			while (cursor < text_end && *cursor != '\n') cursor++;
+			if (cursor < text_end) cursor++;
+			else break;
+		}
+	}
+
+	// Parses lines starting in the [begin, end) byte range of the text by the threads (at most the given count of points).
+	// Each thread parses a part of the range and copies its points into the matching part of the buffer.
+	// Threads first touch their part of the buffer (it lands on their NUMA node), 
+	// same as the static schedule of the engines' scans, so those read mostly local memory.
+	static void parse_points_parallel(const std::string & text, size_t begin, size_t end, size_t max_count, Point_Buffer & points, int thread_count)
+	{
+		std::vector<Point_Buffer> thread_points(thread_count > 0 ? thread_count : omp_get_max_threads());
+		std::vector<size_t> thread_offsets(thread_points.size() + 1, 0);
+
+		#pragma omp parallel num_threads(thread_points.size())
+		{
+			int thread_id    = omp_get_thread_num();
+			int thread_count = omp_get_num_threads();
+
+			size_t range_size  = end - begin;
+			size_t part_begin  = begin + range_size * thread_id / thread_count;
+			size_t part_end    = begin + range_size * (thread_id + 1) / thread_count;
+
+			parse_points(text.c_str(), text.size(), part_begin, part_end, thread_points[thread_id]);
+
+			#pragma omp barrier
+			#pragma omp single
+			{
+				for (int index = 0; index < thread_points.size(); index++) 
+				{
+					thread_offsets[index + 1] = thread_offsets[index] + thread_points[index].size();
+				}
+
+				points.resize(std::min(max_count, thread_offsets.back()));
+			}
+
+			size_t offset = thread_offsets[thread_id];
+			size_t count  = std::min(thread_points[thread_id].size(), points.size() - std::min(points.size(), offset));
+
+			std::copy(thread_points[thread_id].begin(), thread_points[thread_id].begin() + count, points.begin() + offset);
+		}
+	}
+
+	static std::ifstream open_points_file(const std::string & filepath)
 	{
 		std::ifstream input(filepath, std::ios::in | std::ios::binary);
 
@@ -18,21 +117,195 @@ namespace program
 				<< program::panic_end;
 		}
 
-		int point_count;
+		return input;
+	}
+
+	void read_points(std::string filepath, Point_Buffer & points, int thread_count)
+	{
+		auto input = open_points_file(filepath);
+
+		std::string text((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+
+		// The first line is the point count
+		char * header_end;
+		long point_count = std::strtol(text.c_str(), &header_end, 10);
+		size_t body_begin = std::min(text.size(), (size_t)(header_end - text.c_str()));
+
+		// ..a file may have more lines than its point count
+		parse_points_parallel(text, body_begin, text.size(), std::max(0L, point_count), points, thread_count);
+	}
+
+	void get_points_body_range(std::string filepath, size_t & result_begin, size_t & result_end)
+	{
+		auto input = open_points_file(filepath);
+
+		// ..the count line
+		std::string header;
+		std::getline(input, header);
 
-		input >> point_count;
+		result_begin = input.eof() ? header.size() : header.size() + 1;
 
-		for (int index = 0; index < point_count; index++)
+		input.clear();
+		input.seekg(0, std::ios::end);
+		result_end = std::max(result_begin, (size_t)input.tellg());
+	}
+
+	void read_points_range(std::string filepath, size_t begin, size_t end, Point_Buffer & points, int thread_count)
+	{
+		auto input = open_points_file(filepath);
+
+		// The text starts one byte earlier, so a line crossing the range start is recognized (and left to the previous range)
+		size_t text_begin = begin > 0 ? begin - 1 : 0;
+		std::string text(end - text_begin, '\0');
+
+		input.seekg(text_begin);
+		input.read(&text[0], text.size());
+		text.resize(input.gcount());
+
+		// ..the last line, which starts in the range, is read to its end
+		char chunk[4096];
+		while (input && (text.empty() || text.back() != '\n'))
 		{
-			double x, y;
+			input.read(chunk, sizeof(chunk));
 
-			input >> x >> y;
+			std::string rest(chunk, input.gcount());
+			size_t line_end = rest.find('\n');
 
-			points.push_back(Vector2(x, y));
+			text.append(rest, 0, line_end == std::string::npos ? rest.size() : line_end + 1);
+			if (line_end != std::string::npos) break;
 		}
+
+		size_t local_end = std::min(text.size(), end - text_begin);
+
+		parse_points_parallel(text, std::min(local_end, begin - text_begin), local_end, (size_t)-1, points, thread_count);
 	}
 
-	void write_points(std::string filepath, const std::vector<Vector2> & points) 
+	void parse_points_text(const std::string & text, Point_Buffer & points, int thread_count)
+	{
+		parse_points_parallel(text, 0, text.size(), (size_t)-1, points, thread_count);
+	}
+
+	long long scan_points_mapped(std::string filepath, std::function<void(const Vector2 *, int)> consumer, int thread_count)
+	{
+#if __linux__
+		int file = open(filepath.c_str(), O_RDONLY);
+		struct stat status;
+
+		if (file < 0 || fstat(file, &status) != 0)
+		{
+			program::panic_begin 
+				<< "Panic: could not open file at path: " << filepath << "." 
+				<< program::panic_end;
+		}
+
+		size_t size = status.st_size;
+
+		// The file is mapped over an anonymous region one page longer, so a zero byte always follows the text
+		// (parsing may look one byte past the last line)
+		size_t page_size   = sysconf(_SC_PAGESIZE);
+		size_t region_size = (size / page_size + 1) * page_size;
+
+		void * region = mmap(nullptr, region_size, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+		if (region == MAP_FAILED || (size > 0 && mmap(region, size, PROT_READ, MAP_PRIVATE | MAP_FIXED, file, 0) == MAP_FAILED))
+		{
+			program::panic_begin 
+				<< "Panic: could not map file at path: " << filepath << "." 
+				<< program::panic_end;
+		}
+
+		close(file);
+		madvise(region, size, MADV_SEQUENTIAL);
+
+		const char * text = (const char *)region;
+#else
+		auto input = open_points_file(filepath);
+
+		std::string content((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+
+		const char * text = content.c_str();
+		size_t size = content.size();
+#endif
+
+		// ..the count line is skipped
+		const char * header_end = (const char *)std::memchr(text, '\n', size);
+		size_t body_begin = header_end != nullptr ? header_end - text + 1 : size;
+
+		long long chunk_count = (size - body_begin + mapped_scan_chunk_size - 1) / mapped_scan_chunk_size;
+		long long point_count = 0;
+
+		#pragma omp parallel num_threads(thread_count > 0 ? thread_count : omp_get_max_threads()) reduction(+:point_count)
+		{
+			Point_Buffer points;
+
+			#pragma omp for schedule(dynamic, 1)
+			for (long long chunk = 0; chunk < chunk_count; chunk++)
+			{
+				size_t begin = body_begin + chunk * mapped_scan_chunk_size;
+				size_t end   = std::min(size, begin + mapped_scan_chunk_size);
+
+				points.clear();
+				parse_points(text, size, begin, end, points);
+
+				point_count += points.size();
+
+				if (!points.empty()) consumer(points.data(), points.size());
+			}
+		}
+
+#if __linux__
+		munmap(region, region_size);
+#endif
+
+		return point_count;
+	}
+
+
+	Points_Block_Reader::Points_Block_Reader(std::string filepath, size_t block_size) : 
+		input(open_points_file(filepath)),
+		block_size(block_size)
+	{
+		std::string header;
+		std::getline(this->input, header);
+
+		this->point_count = std::strtol(header.c_str(), nullptr, 10);
+	}
+
+	bool Points_Block_Reader::read_block(std::string & result_text)
+	{
+		result_text.swap(this->rest);
+		this->rest.clear();
+
+		if (!this->input) return !result_text.empty();
+
+		size_t size = result_text.size();
+		result_text.resize(size + this->block_size);
+
+		this->input.read(&result_text[size], this->block_size);
+		result_text.resize(size + this->input.gcount());
+
+		// ..the unfinished last line waits for the next block
+		if (this->input) 
+		{
+			size_t line_end = result_text.rfind('\n');
+
+			if (line_end != std::string::npos) 
+			{
+				this->rest.assign(result_text, line_end + 1, std::string::npos);
+				result_text.resize(line_end + 1);
+			}
+			else 
+			{
+				this->rest.swap(result_text);
+				result_text.clear();
+			}
+		}
+
+		return !result_text.empty() || !this->rest.empty();
+	}
+
+
+	void write_points(std::string filepath, const Point_Buffer & points) 
 	{
 		std::ofstream output(filepath, std::ios::out | std::ios::trunc | std::ios::binary);
 
@@ -58,4 +331,56 @@ namespace program
 		// 	std::cout << "writted point count: " << writted_point_count << std::endl;
 		// }
 	}
+	bool read_setting(std::string filepath, std::string key, std::string & result)
+	{
+		std::ifstream input(filepath);
+		std::string line;
+
+		while (std::getline(input, line))
+		{
+			std::istringstream stream(line);
+			std::string line_key;
+
+			if (stream >> line_key && line_key == key && stream >> result) 
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void write_setting(std::string filepath, std::string key, std::string value)
+	{
+		std::vector<std::string> lines;
+		
+		// Keeps other settings
+		{
+			std::ifstream input(filepath);
+			std::string line;
+
+			while (std::getline(input, line))
+			{
+				std::istringstream stream(line);
+				std::string line_key;
+
+				if (stream >> line_key && line_key == key) continue;
+
+				lines.push_back(line);
+			}
+		}
+
+		lines.push_back(key + " " + value);
+
+		std::ofstream output(filepath, std::ios::out | std::ios::trunc);
+
+		if (output.fail())
+		{
+			program::panic_begin 
+				<< "Panic: could not open file at path: " << filepath << "." 
+				<< program::panic_end;
+		}
+
+		for (const auto & line : lines) output << line << std::endl;
+	}
 }
\ No newline at end of file
@@ -3,6 +3,8 @@
 // standard
 #include <string>
 #include <vector>
+#include <fstream>
+#include <functional>
 
 // internal
 #include "core.hpp"
@@ -10,6 +12,45 @@
 
 namespace program
 {
-	extern void read_points(std::string filepath, std::vector<Vector2> & points);
-	extern void write_points(std::string filepath, const std::vector<Vector2> & points);
+	// Points are parsed by the given count of threads (0: the Open MP default), the engine's count keeps its first touch
+	extern void read_points(std::string filepath, Point_Buffer & points, int thread_count = 0);
+	// Returns the byte range of the point lines (after the count line)
+	extern void get_points_body_range(std::string filepath, size_t & result_begin, size_t & result_end);
+	// Reads points of the lines, which start in the [begin, end) byte range of the file (used by shard workers)
+	extern void read_points_range(std::string filepath, size_t begin, size_t end, Point_Buffer & points, int thread_count = 0);
+	// Parses all lines of the text (e.g. a block of the reader) by the threads
+	extern void parse_points_text(const std::string & text, Point_Buffer & points, int thread_count = 0);
+
+	// Mapped scans parse this many bytes of lines at once (per thread)
+	static const size_t mapped_scan_chunk_size = 1 << 20;
+
+	// Maps the points file into memory (it is never copied) and parses chunks of its lines by the threads,
+	// the consumer gets the points of each chunk from the parsing thread. Returns the count of points (the count line is skipped).
+	extern long long scan_points_mapped(std::string filepath, std::function<void(const Vector2 *, int)> consumer, int thread_count = 0);
+
+
+	// Reads the points file in blocks of whole lines (the pipelined computing parses them while the next block is read)
+	struct Points_Block_Reader
+	{
+		private: // fields
+			std::ifstream input;
+			std::string   rest;        // ..start of the line, which continues in the next block
+			size_t        block_size;
+			long          point_count; // ..of the count line
+
+		public: // getters
+			long get_point_count() const { return point_count; }
+
+		public: // constructors
+			Points_Block_Reader(std::string filepath, size_t block_size);
+
+		public: // methods
+			// Returns false at the end of the file
+			bool read_block(std::string & result_text);
+	};
+	extern void write_points(std::string filepath, const Point_Buffer & points);
+
+	// Settings file consists of "key value" lines
+	extern bool read_setting(std::string filepath, std::string key, std::string & result);
+	extern void write_setting(std::string filepath, std::string key, std::string value);
 }
\ No newline at end of file
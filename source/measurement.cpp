@@ -0,0 +1,40 @@
+// standard
+#include <algorithm>
+#include <cmath>
+
+// internal
+#include "measurement.hpp"
+
+namespace program
+{
+	Measurement_Statistics compute_measurement_statistics(std::vector<double> samples)
+	{
+		Measurement_Statistics statistics = { 0, 0, 0, 0, 0, 0 };
+
+		if (samples.empty()) 
+		{
+			return statistics;
+		}
+
+		std::sort(samples.begin(), samples.end());
+
+		int count = samples.size();
+		double sum = 0;
+
+		for (auto sample : samples) sum += sample;
+
+		// Uses the nearest-rank method for the percentile
+		int p95_rank = (int)std::ceil(0.95 * count) - 1;
+
+		statistics.count  = count;
+		statistics.min    = samples.front();
+		statistics.max    = samples.back();
+		statistics.mean   = sum / count;
+		statistics.p95    = samples[std::max(0, p95_rank)];
+		statistics.median = (count % 2 == 1) 
+			? samples[count / 2] 
+			: (samples[count / 2 - 1] + samples[count / 2]) / 2;
+
+		return statistics;
+	}
+}
\ No newline at end of file
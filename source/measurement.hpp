@@ -0,0 +1,21 @@
+#pragma once
+
+// standard
+#include <vector>
+
+namespace program
+{
+	// Summary of repeated time measurements (milliseconds)
+	struct Measurement_Statistics
+	{
+		public: // fields
+			int    count;
+			double min;
+			double median;
+			double p95;
+			double max;
+			double mean;
+	};
+
+	extern Measurement_Statistics compute_measurement_statistics(std::vector<double> samples);
+}
\ No newline at end of file
@@ -0,0 +1,200 @@
+// standard
+#include <new>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+
+// internal
+#include "memory_accounting.hpp"
+
+namespace program
+{
+	static bool is_accounting_enabled = false;
+
+	static std::atomic<long long> allocation_count(0);
+	static std::atomic<long long> allocated_bytes(0);
+	static std::atomic<long long> live_bytes(0);
+	static std::atomic<long long> peak_live_bytes(0);
+
+
+	// Each block starts by a header with its accounted size (-1 for blocks allocated before accounting was enabled),
+	// so deleting a block subtracts exactly what was added for it. The header keeps the alignment of malloc.
+	static const size_t block_header_size = alignof(std::max_align_t);
+
+	static inline void account_allocation(long long size)
+	{
+		long long live = live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+		long long peak = peak_live_bytes.load(std::memory_order_relaxed);
+
+		allocation_count.fetch_add(1, std::memory_order_relaxed);
+		allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+
+		while (live > peak && !peak_live_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) { }
+	}
+
+	// Returns the block after its header or null pointer when malloc fails
+	static inline void * allocate_block(size_t size)
+	{
+		if (size > SIZE_MAX - block_header_size) return nullptr;
+
+		void * start = std::malloc(block_header_size + size);
+
+		if (start == nullptr) return nullptr;
+
+		long long accounted_size = is_accounting_enabled ? (long long)size : -1;
+
+		*(long long *)start = accounted_size;
+
+		if (accounted_size >= 0) account_allocation(accounted_size);
+
+		return (char *)start + block_header_size;
+	}
+
+	static inline void deallocate_block(void * block)
+	{
+		void * start = (char *)block - block_header_size;
+
+		long long accounted_size = *(long long *)start;
+
+		if (accounted_size >= 0) live_bytes.fetch_sub(accounted_size, std::memory_order_relaxed);
+
+		std::free(start);
+	}
+
+	// Reads a "Vm..." value (in kB) from the process status
+	static long long read_process_status_bytes(const std::string & key)
+	{
+		std::ifstream input("/proc/self/status");
+		std::string line;
+
+		while (std::getline(input, line))
+		{
+			if (line.compare(0, key.size(), key) != 0) continue;
+
+			std::istringstream stream(line.substr(key.size() + 1));
+			long long kilobytes = 0;
+			stream >> kilobytes;
+
+			return kilobytes * 1024;
+		}
+
+		return 0;
+	}
+
+	// Resets the peak resident set size (supported by linux 4.0+)
+	static void reset_peak_resident_bytes()
+	{
+		std::ofstream output("/proc/self/clear_refs");
+		output << "5";
+	}
+
+
+	void enable_memory_accounting()
+	{
+		is_accounting_enabled = true;
+	}
+
+	bool is_memory_accounting_enabled()
+	{
+		return is_accounting_enabled;
+	}
+
+
+	std::string Memory_Usage::get_text() const
+	{
+		std::ostringstream builder;
+
+		builder 
+			<< "allocations: " << allocation_count 
+			<< ", allocated: " << allocated_bytes / (1024.0 * 1024.0) << " MB"
+			<< ", peak heap: " << peak_heap_bytes / (1024.0 * 1024.0) << " MB"
+			<< ", peak resident: " << peak_resident_bytes / (1024.0 * 1024.0) << " MB";
+
+		return builder.str();
+	}
+
+
+	void Memory_Phase::begin()
+	{
+		start_allocation_count = allocation_count.load();
+		start_allocated_bytes  = allocated_bytes.load();
+
+		peak_live_bytes.store(live_bytes.load());
+		reset_peak_resident_bytes();
+	}
+
+	void Memory_Phase::end()
+	{
+		usage.allocation_count    = allocation_count.load() - start_allocation_count;
+		usage.allocated_bytes     = allocated_bytes.load() - start_allocated_bytes;
+		usage.peak_heap_bytes     = peak_live_bytes.load();
+		usage.peak_resident_bytes = read_process_status_bytes("VmHWM:");
+	}
+}
+
+
+// Global allocation functions (counting only when accounting is enabled)
+
+void * operator new(size_t size)
+{
+	// ..the new handler may free memory, so allocating is retried until there is none
+	while (true)
+	{
+		void * block = program::allocate_block(size);
+
+		if (block != nullptr) return block;
+
+		std::new_handler handler = std::get_new_handler();
+
+		if (handler == nullptr) throw std::bad_alloc();
+
+		handler();
+	}
+}
+
+void * operator new[](size_t size)
+{
+	return operator new(size);
+}
+
+void * operator new(size_t size, const std::nothrow_t &) noexcept
+{
+	try 
+	{
+		return operator new(size);
+	}
+	catch (const std::bad_alloc &) 
+	{
+		return nullptr;
+	}
+}
+
+void * operator new[](size_t size, const std::nothrow_t & tag) noexcept
+{
+	return operator new(size, tag);
+}
+
+void operator delete(void * block) noexcept
+{
+	if (block == nullptr) return;
+
+	program::deallocate_block(block);
+}
+
+void operator delete[](void * block) noexcept
+{
+	operator delete(block);
+}
+
+void operator delete(void * block, const std::nothrow_t &) noexcept
+{
+	operator delete(block);
+}
+
+void operator delete[](void * block, const std::nothrow_t &) noexcept
+{
+	operator delete(block);
+}
\ No newline at end of file
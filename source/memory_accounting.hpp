@@ -0,0 +1,42 @@
+#pragma once
+
+// standard
+#include <string>
+
+namespace program
+{
+	// Heap and resident memory usage of a program phase
+	struct Memory_Usage
+	{
+		public: // fields
+			long long allocation_count;
+			long long allocated_bytes;     // ..total bytes requested by allocations
+			long long peak_heap_bytes;     // ..maximum of simultaneously allocated bytes
+			long long peak_resident_bytes; // ..maximum resident set size (process-wide when the kernel cannot reset it)
+
+		public: // methods
+			std::string get_text() const;
+	};
+
+
+	// Counts allocations of the global operator new (when enabled) 
+	extern void enable_memory_accounting();
+	extern bool is_memory_accounting_enabled();
+
+
+	// Measures memory usage between [ begin ] and [ end ]
+	struct Memory_Phase
+	{
+		private: // fields
+			Memory_Usage usage;
+			long long    start_allocation_count;
+			long long    start_allocated_bytes;
+
+		public: // getters
+			const Memory_Usage & get_usage() const { return usage; }
+
+		public: // methods
+			void begin();
+			void end();
+	};
+}
\ No newline at end of file
@@ -0,0 +1,270 @@
+// standard
+#include <sstream>
+#include <cstring>
+#include <cstdint>
+
+// external
+#if __linux__
+	#include <unistd.h>
+	#include <sys/ioctl.h>
+	#include <sys/syscall.h>
+	#include <linux/perf_event.h>
+#endif
+
+#if _OPENMP
+	#include "omp.h"
+#endif
+
+// internal
+#include "performance_counters.hpp"
+
+namespace program
+{
+	// Number of counters opened per thread (as a single group)
+	static const int counters_per_thread = 4;
+
+#if __linux__
+	static const uint64_t counter_configs[counters_per_thread] = 
+	{
+		PERF_COUNT_HW_CPU_CYCLES,
+		PERF_COUNT_HW_INSTRUCTIONS,
+		PERF_COUNT_HW_CACHE_MISSES, // ..usually counts last level cache misses
+		PERF_COUNT_HW_BRANCH_MISSES
+	};
+
+	// Opens a counter of the calling thread on any cpu
+	static int open_counter(uint64_t config, int group_file_descriptor)
+	{
+		perf_event_attr attributes;
+		std::memset(&attributes, 0, sizeof(attributes));
+
+		attributes.size           = sizeof(attributes);
+		attributes.type           = PERF_TYPE_HARDWARE;
+		attributes.config         = config;
+		attributes.disabled       = group_file_descriptor == -1 ? 1 : 0; // ..the group is enabled by its leader
+		attributes.exclude_kernel = 1;
+		attributes.exclude_hv     = 1;
+		attributes.read_format    = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+		return syscall(__NR_perf_event_open, &attributes, 0, -1, group_file_descriptor, 0);
+	}
+#endif
+
+
+	Hardware_Counter_Values::Hardware_Counter_Values() : 
+		cycles(0), 
+		instructions(0), 
+		cache_misses(0), 
+		branch_misses(0)
+	{
+	}
+
+	double Hardware_Counter_Values::get_instructions_per_cycle() const
+	{
+		return cycles == 0 ? 0 : (double)instructions / cycles;
+	}
+
+	void Hardware_Counter_Values::add(const Hardware_Counter_Values & other)
+	{
+		cycles        += other.cycles;
+		instructions  += other.instructions;
+		cache_misses  += other.cache_misses;
+		branch_misses += other.branch_misses;
+	}
+
+	std::string Hardware_Counter_Values::get_text() const
+	{
+		std::ostringstream builder;
+
+		builder 
+			<< "cycles: " << cycles 
+			<< ", instructions: " << instructions 
+			<< " (ipc: " << get_instructions_per_cycle() << ")"
+			<< ", llc misses: " << cache_misses 
+			<< ", branch misses: " << branch_misses;
+
+		return builder.str();
+	}
+
+	std::string Hardware_Counter_Values::get_json() const
+	{
+		std::ostringstream builder;
+
+		builder 
+			<< "{ \"cycles\": " << cycles 
+			<< ", \"instructions\": " << instructions 
+			<< ", \"llc_misses\": " << cache_misses 
+			<< ", \"branch_misses\": " << branch_misses 
+			<< " }";
+
+		return builder.str();
+	}
+
+
+
+	Hardware_Counters_Session::~Hardware_Counters_Session()
+	{
+		close();
+	}
+
+	Hardware_Counters_Session::Hardware_Counters_Session() : 
+		is_available(false)
+	{
+	}
+
+	Hardware_Counter_Values Hardware_Counters_Session::get_total_values() const
+	{
+		Hardware_Counter_Values total;
+
+		for (const auto & values : thread_values) total.add(values);
+
+		return total;
+	}
+
+	bool Hardware_Counters_Session::start(int thread_count)
+	{
+		close();
+		thread_values.clear();
+
+#if __linux__
+		// ..the team of the engine, which owns its thread count
+	#if _OPENMP
+		if (thread_count <= 0) thread_count = omp_get_max_threads();
+	#else
+		thread_count = 1;
+	#endif
+
+		file_descriptors.assign(thread_count * counters_per_thread, -1);
+
+		// Counters measure only the thread which opened them,
+		// so each thread of the team opens its own group
+		auto open_thread_counters = [this](int thread_id) 
+		{
+			int * group = &file_descriptors[thread_id * counters_per_thread];
+
+			for (int index = 0; index < counters_per_thread; index++)
+			{
+				group[index] = open_counter(counter_configs[index], index == 0 ? -1 : group[0]);
+
+				if (group[index] == -1) return;
+			}
+		};
+
+	#if _OPENMP
+		#pragma omp parallel num_threads(thread_count)
+		{
+			open_thread_counters(omp_get_thread_num());
+		}
+	#else
+		open_thread_counters(0);
+	#endif
+
+		for (auto file_descriptor : file_descriptors)
+		{
+			if (file_descriptor == -1) 
+			{
+				close();
+				return false;
+			}
+		}
+
+		is_available = true;
+		thread_values.resize(thread_count);
+
+		for (int thread_id = 0; thread_id < thread_count; thread_id++)
+		{
+			int leader = file_descriptors[thread_id * counters_per_thread];
+
+			ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+			ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+		}
+
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	void Hardware_Counters_Session::stop()
+	{
+#if __linux__
+		if (!is_available) return;
+
+		int thread_count = thread_values.size();
+
+		for (int thread_id = 0; thread_id < thread_count; thread_id++)
+		{
+			ioctl(file_descriptors[thread_id * counters_per_thread], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+		}
+
+		for (int thread_id = 0; thread_id < thread_count; thread_id++)
+		{
+			// Layout of a group read: count, time enabled, time running, values
+			uint64_t buffer[3 + counters_per_thread] = { 0 };
+
+			if (read(file_descriptors[thread_id * counters_per_thread], buffer, sizeof(buffer)) <= 0) continue;
+
+			// Scales values when counters were multiplexed
+			double scale = (buffer[2] > 0 && buffer[2] < buffer[1]) ? (double)buffer[1] / buffer[2] : 1.0;
+
+			auto & values = thread_values[thread_id];
+
+			values.cycles        = buffer[3] * scale;
+			values.instructions  = buffer[4] * scale;
+			values.cache_misses  = buffer[5] * scale;
+			values.branch_misses = buffer[6] * scale;
+		}
+
+		close();
+		is_available = true; // ..values stay readable after closing
+#endif
+	}
+
+	std::string Hardware_Counters_Session::get_text() const
+	{
+		if (!is_available) return std::string("unavailable");
+
+		std::ostringstream builder;
+
+		builder << "{ total: { " << get_total_values().get_text() << " }";
+
+		for (int thread_id = 0; thread_id < thread_values.size(); thread_id++)
+		{
+			builder << "\n\t thread " << thread_id << ": { " << thread_values[thread_id].get_text() << " }";
+		}
+
+		builder << "\n }";
+
+		return builder.str();
+	}
+
+	std::string Hardware_Counters_Session::get_json() const
+	{
+		if (!is_available) return std::string("null");
+
+		std::ostringstream builder;
+
+		builder << "{ \"total\": " << get_total_values().get_json() << ", \"threads\": [ ";
+
+		for (int thread_id = 0; thread_id < thread_values.size(); thread_id++)
+		{
+			builder << (thread_id == 0 ? "" : ", ") << thread_values[thread_id].get_json();
+		}
+
+		builder << " ] }";
+
+		return builder.str();
+	}
+
+	void Hardware_Counters_Session::close()
+	{
+#if __linux__
+		for (auto file_descriptor : file_descriptors)
+		{
+			if (file_descriptor != -1) ::close(file_descriptor);
+		}
+#endif
+		file_descriptors.clear();
+		is_available = false;
+	}
+}
\ No newline at end of file
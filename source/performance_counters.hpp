@@ -0,0 +1,61 @@
+#pragma once
+
+// standard
+#include <string>
+#include <vector>
+
+namespace program
+{
+	// Values of hardware performance counters of a single thread
+	struct Hardware_Counter_Values
+	{
+		public: // fields
+			long long cycles;
+			long long instructions;
+			long long cache_misses;  // ..last level cache misses
+			long long branch_misses;
+
+		public: // constructors
+			Hardware_Counter_Values();
+
+		public: // getters
+			double get_instructions_per_cycle() const;
+
+		public: // methods
+			void add(const Hardware_Counter_Values & other);
+			std::string get_text() const;
+			std::string get_json() const;
+	};
+
+
+	// Captures hardware performance counters (Linux perf_event_open) 
+	// of the calling thread and of every thread of the Open MP team.
+	struct Hardware_Counters_Session
+	{
+		private: // fields
+			std::vector<int>                     file_descriptors; // ..group leaders first, per thread
+			std::vector<Hardware_Counter_Values> thread_values;
+			bool                                 is_available;
+
+		public: // constructors & destructors
+			~Hardware_Counters_Session();
+			Hardware_Counters_Session();
+
+		public: // getters
+			bool is_counting_available() const { return is_available; }
+			const std::vector<Hardware_Counter_Values> & get_thread_values() const { return thread_values; }
+			Hardware_Counter_Values get_total_values() const;
+
+		public: // methods
+			// Opens and enables counters for the team of the given size (0: the Open MP default), 
+			// returns false when counters are not supported
+			bool start(int thread_count = 0);
+			void stop();
+
+			std::string get_text() const;
+			std::string get_json() const;
+
+		private: // methods
+			void close();
+	};
+}
\ No newline at end of file
@@ -0,0 +1,115 @@
+// internal
+#include "predicates.hpp"
+
+namespace predicates
+{
+	// Error-free transformations: x + y equals exactly the result of the operation
+	static inline void two_sum(double a, double b, double & x, double & y)
+	{
+		x = a + b;
+		double b_virtual = x - a;
+		double a_virtual = x - b_virtual;
+		y = (a - a_virtual) + (b - b_virtual);
+	}
+
+	static inline void two_product(double a, double b, double & x, double & y)
+	{
+		x = a * b;
+		y = std::fma(a, b, -x);
+	}
+
+	// Adds a number to a nonoverlapping expansion (ordered by increasing magnitude), skips zero components
+	static inline int grow_expansion(const double * expansion, int length, double number, double * result)
+	{
+		int result_length = 0;
+		double sum = number;
+
+		for (int index = 0; index < length; index++)
+		{
+			double error;
+			two_sum(sum, expansion[index], sum, error);
+
+			if (error != 0) result[result_length++] = error;
+		}
+
+		if (sum != 0 || result_length == 0) result[result_length++] = sum;
+
+		return result_length;
+	}
+
+	// Returns the sum of products of the factor pairs rounded from its exact value (so the sign is exact)
+	static double sum_products_exact(const double (* factors)[2], int count)
+	{
+		double expansion[2][16];
+		int length = 0;
+		int current = 0;
+
+		for (int index = 0; index < count; index++)
+		{
+			double product, error;
+			two_product(factors[index][0], factors[index][1], product, error);
+
+			length = grow_expansion(expansion[current], length, error, expansion[1 - current]);
+			current = 1 - current;
+
+			length = grow_expansion(expansion[current], length, product, expansion[1 - current]);
+			current = 1 - current;
+		}
+
+		// The most significant component has the sign of the whole expansion
+		return expansion[current][length - 1];
+	}
+
+	static inline int get_sign(double value)
+	{
+		return (value > 0) - (value < 0);
+	}
+
+
+	double orientation_exact(const Vector2 & a, const Vector2 & b, const Vector2 & c)
+	{
+		// (bx - ax)(cy - ay) - (by - ay)(cx - ax) expanded into products of input coordinates
+		// (the ax * ay terms cancel out)
+		const double factors[6][2] = 
+		{
+			{  b.x, c.y }, { -b.x, a.y }, { -a.x, c.y },
+			{ -b.y, c.x }, {  b.y, a.x }, {  a.y, c.x }
+		};
+
+		return sum_products_exact(factors, 6);
+	}
+
+	int compare_orientation_exact(const Vector2 & a, const Vector2 & b, const Vector2 & c, const Vector2 & d)
+	{
+		// (bx - ax)(cy - dy) - (by - ay)(cx - dx)
+		const double factors[8][2] = 
+		{
+			{  b.x, c.y }, { -b.x, d.y }, { -a.x, c.y }, {  a.x, d.y },
+			{ -b.y, c.x }, {  b.y, d.x }, {  a.y, c.x }, { -a.y, d.x }
+		};
+
+		return get_sign(sum_products_exact(factors, 8));
+	}
+
+	int compare_projection_exact(const Vector2 & a, const Vector2 & b, const Vector2 & c, const Vector2 & d)
+	{
+		// (bx - ax)(cx - dx) + (by - ay)(cy - dy)
+		const double factors[8][2] = 
+		{
+			{  b.x, c.x }, { -b.x, d.x }, { -a.x, c.x }, {  a.x, d.x },
+			{  b.y, c.y }, { -b.y, d.y }, { -a.y, c.y }, {  a.y, d.y }
+		};
+
+		return get_sign(sum_products_exact(factors, 8));
+	}
+
+	bool is_further_exact(const Vector2 & a, const Vector2 & b, const Vector2 & e, const Vector2 & c)
+	{
+		// Right side points have negative orientation
+		int comparison = compare_orientation_exact(a, b, c, e);
+
+		if (comparison != 0) return comparison > 0;
+
+		return compare_projection_exact(a, b, e, c) < 0;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#pragma once
+
+// standard
+#include <cmath>
+#include <cfloat>
+
+// internal
+#include "core.hpp"
+
+// Geometric predicates without division.
+// The fast path filters rounding errors and only nearly degenerate cases reach the exact (adaptive) arithmetic.
+namespace predicates
+{
+	// Relative error bound of the floating point orientation (Shewchuk's ccwerrboundA)
+	static const double orientation_error_bound = (3.0 + 16.0 * (DBL_EPSILON / 2)) * (DBL_EPSILON / 2);
+
+	// Returns the orientation computed with expansion arithmetic (its sign is exact)
+	extern double orientation_exact(const Vector2 & a, const Vector2 & b, const Vector2 & c);
+
+	// Returns the exact sign of orientation(A, B, C) - orientation(A, B, D), which is the cross product of AB and DC
+	extern int compare_orientation_exact(const Vector2 & a, const Vector2 & b, const Vector2 & c, const Vector2 & d);
+	
+	// Returns the exact sign of the dot product of AB and DC (C is further along AB than D when positive)
+	extern int compare_projection_exact(const Vector2 & a, const Vector2 & b, const Vector2 & c, const Vector2 & d);
+
+	// Returns true when the point E is (exactly) further on the right side of the AB line than the point C.
+	// Among equally far points the one closer to A is further (so the result is always a strict convex hull vertex).
+	extern bool is_further_exact(const Vector2 & a, const Vector2 & b, const Vector2 & e, const Vector2 & c);
+
+
+	// Returns the floating point orientation and the bound of its absolute error
+	inline double orientation_filtered(const Vector2 & a, const Vector2 & b, const Vector2 & c, double & error)
+	{
+		double left  = (b.x - a.x) * (c.y - a.y);
+		double right = (b.y - a.y) * (c.x - a.x);
+
+		error = orientation_error_bound * (std::fabs(left) + std::fabs(right));
+
+		return left - right;
+	}
+
+	// Returns a positive value when the C point lies on the left side of the AB line, 
+	// negative when on the right side and zero when the points are collinear.
+	// The sign is always exact, the magnitude is twice the area of the ABC triangle (approximately).
+	inline double orientation(const Vector2 & a, const Vector2 & b, const Vector2 & c)
+	{
+		double error;
+		double determinant = orientation_filtered(a, b, c, error);
+
+		if (std::fabs(determinant) > error)
+		{
+			return determinant;
+		}
+
+		return orientation_exact(a, b, c);
+	}
+}
\ No newline at end of file
@@ -12,12 +12,16 @@ namespace program
 
 		public: // ..getters
 			quick_hull::Algorithm & get_executor_instance() const { return *algorithm; }
+			// Threads of the algorithm instance, also used for reading its points (0: the Open MP default)
+			virtual int get_thread_count() const { return 0; }
 
 		public: // ..deconstructors
-			~Algorithm_Configuration_Base() { delete algorithm; }
+			virtual ~Algorithm_Configuration_Base() { delete algorithm; }
 
 		public: // ..abstract methods
 			virtual std::string get_info_text() const = 0;
 			virtual std::string get_runtime_info_text() const { return std::string(""); }
+			// Writes runtime data files (e.g. traces) after the algorithm run
+			virtual void export_runtime_data() const { }
 	};
 }
\ No newline at end of file
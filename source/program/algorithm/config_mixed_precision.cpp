@@ -0,0 +1,77 @@
+// standard
+#include <sstream>
+
+// internal
+#include "input_configuration.hpp"
+#include "algorithm/mixed_precision.hpp"
+#include "program/constants.hpp"
+#include "./config_mixed_precision.hpp"
+
+namespace program 
+{
+	Algorithm_Configuration_Mixed_Precision::Algorithm_Configuration_Mixed_Precision
+	(
+		Algorithm_Configuration_Base * refinement_config
+	)
+	{
+		this->refinement_config = refinement_config;
+		this->algorithm = nullptr;
+	}
+
+	bool Algorithm_Configuration_Mixed_Precision::try_initialize
+	(
+		Input_Configuration input, 
+		bool allow_panic
+	)
+	{
+		bool is_there_mixed_precision_flag = false;
+
+		for (auto iterator = Input_Configuration_Iterator(input); iterator.move_next();) 
+		{
+			if (iterator.is_argument(program_arguments_tag::mixed_precision)) 
+			{
+				is_there_mixed_precision_flag = true;
+			}
+		}
+
+		this->algorithm = new quick_hull::Algorithm_Mixed_Precision(&this->refinement_config->get_executor_instance(), false, this->refinement_config->get_thread_count());
+
+		return is_there_mixed_precision_flag;
+	}
+
+
+	std::string Algorithm_Configuration_Mixed_Precision::get_info_text() const 
+	{
+		return "Mixed precision { refinement: " + this->refinement_config->get_info_text() + " }";
+	}
+
+
+	std::string Algorithm_Configuration_Mixed_Precision::get_runtime_info_text() const 
+	{
+		std::ostringstream builder;
+
+		if (auto * algorithm_mixed_precision = dynamic_cast<quick_hull::Algorithm_Mixed_Precision * >(this->algorithm)) 
+		{
+			int refined_count  = algorithm_mixed_precision->get_refined_point_count();
+			int filtered_count = algorithm_mixed_precision->get_filtered_point_count();
+			int total_count    = refined_count + filtered_count;
+
+			builder 
+				<< "{ refined points: " << refined_count 
+				<< " of " << total_count 
+				<< " (" << (total_count > 0 ? 100.0 * refined_count / total_count : 0.0) << "%) }";
+		}
+
+		std::string refinement_text = this->refinement_config->get_runtime_info_text();
+
+		if (!refinement_text.empty()) builder << "\n " << refinement_text;
+
+		return builder.str();
+	}
+
+
+	void Algorithm_Configuration_Mixed_Precision::export_runtime_data() const 
+	{
+		this->refinement_config->export_runtime_data();
+	}
+}
\ No newline at end of file
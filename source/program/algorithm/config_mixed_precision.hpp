@@ -0,0 +1,26 @@
+#pragma once
+
+// internal
+#include "input_configuration.hpp"
+#include "./config_base.hpp"
+
+namespace program 
+{
+	// Wraps the selected algorithm configuration, its algorithm refines points left by the float32 filter
+	struct Algorithm_Configuration_Mixed_Precision : public Algorithm_Configuration_Base 
+	{
+		private: // ..fields
+			Algorithm_Configuration_Base * refinement_config;
+
+		public: // ..constructors & destructors
+			Algorithm_Configuration_Mixed_Precision(Algorithm_Configuration_Base * refinement_config);
+			~Algorithm_Configuration_Mixed_Precision() { delete refinement_config; }
+
+		public: // ..methods
+			int get_thread_count() const override { return refinement_config->get_thread_count(); }
+			std::string get_info_text() const override;
+			std::string get_runtime_info_text() const override;
+			void export_runtime_data() const override;
+			bool try_initialize(Input_Configuration input, bool allow_panic) override;
+	};
+}
\ No newline at end of file
@@ -1,7 +1,12 @@
+// standard
+#include <cstdlib>
+#include <algorithm>
+
 // external
 #include "omp.h"
 
 // internal
+#include "io.hpp"
 #include "console.hpp"
 #include "input_configuration.hpp"
 #include "algorithm/openmp.hpp"
@@ -19,25 +24,91 @@ namespace program
 		bool is_there_openmp_flag = false;
 		this->thread_count = omp_get_max_threads();
 
+		// Thread count saved by the thread sweep is used by default
+		std::string saved_thread_count;
+		if (read_setting(program_settings::filepath, program_settings::openmp_threads, saved_thread_count)) 
+		{
+			this->thread_count = std::max(1, std::atoi(saved_thread_count.c_str()));
+		}
+		this->is_collecting_statistics = false;
+		this->pinning = Thread_Pinning::None;
+		this->is_reporting_numa = false;
+		this->is_pinned = false;
+
+		// ..the engine is tried without panics, but when it is requested its values have to be valid
 		for (auto iterator = Input_Configuration_Iterator(input); iterator.move_next();) 
 		{
-			if (iterator.is_argument(program_arguments_tag::openmp)) 
+			if (iterator.is_argument(program_arguments_tag::openmp)) is_there_openmp_flag = true;
+		}
+
+		allow_panic = allow_panic || is_there_openmp_flag;
+
+		for (auto iterator = Input_Configuration_Iterator(input); iterator.move_next();) 
+		{
+			if (iterator.is_argument(program_arguments_tag::openmp_threads)) 
 			{
-				is_there_openmp_flag = true;
+				if (iterator.move_next()) 
+				{
+					this->thread_count = iterator.get_argument_as_int();
+				}
+				else if (allow_panic) program::panic_begin << "Panic: open mp thread count value is missing!" << program::panic_end;
 			}
 			else
-			if (iterator.is_argument(program_arguments_tag::openmp_threads)) 
+			if (iterator.is_argument(program_arguments_tag::statistics)) 
+			{
+				this->is_collecting_statistics = true;
+			}
+			else
+			if (iterator.is_argument(program_arguments_tag::openmp_pin)) 
+			{
+				if (!iterator.move_next()) 
+				{
+					if (allow_panic) program::panic_begin << "Panic: open mp pinning value is missing!" << program::panic_end;
+				}
+				else 
+				if (!try_parse_thread_pinning(iterator.get_argument_as_string(), this->pinning) && allow_panic) 
+				{
+					program::panic_begin << "Panic: unknown open mp pinning: " << iterator.get_argument_as_string() << "!" << program::panic_end;
+				}
+			}
+			else
+			if (iterator.is_argument(program_arguments_tag::numa_report)) 
+			{
+				this->is_reporting_numa = true;
+			}
+			else
+			if (iterator.is_argument(program_arguments_tag::openmp_trace)) 
 			{
 				if (iterator.move_next()) 
 				{
-					this->thread_count = iterator.get_argument_as_int();
+					this->trace_filepath = iterator.get_argument_as_string();
 				}
-				else if (allow_panic) program::panic_begin << "Panic: open mp thread count value is missing!";
+				else if (allow_panic) program::panic_begin << "Panic: open mp trace filepath is missing!" << program::panic_end;
 			}
 		}
 
-		this->algorithm = new quick_hull::Algorithm_OpenMP();
-		omp_set_num_threads(this->thread_count);
+		this->thread_count = std::max(1, this->thread_count);
+
+		// ..the instance owns its thread count (the process-wide Open MP setting is not changed)
+		auto * algorithm_openmp = new quick_hull::Algorithm_OpenMP(this->is_collecting_statistics, this->thread_count);
+
+		if (!this->trace_filepath.empty()) 
+		{
+			algorithm_openmp->set_trace(&this->trace);
+		}
+
+		if (this->is_reporting_numa) 
+		{
+			algorithm_openmp->set_root_scans(&this->root_scans);
+		}
+
+		this->algorithm = algorithm_openmp;
+
+		// ..pinned only when the engine is used (threads keep their cpus for reading and computing)
+		if (is_there_openmp_flag && this->pinning != Thread_Pinning::None) 
+		{
+			this->is_pinned = bind_openmp_threads(get_pinning_cpus(this->pinning), this->thread_count);
+		}
 
 		return is_there_openmp_flag;
 	}
@@ -49,9 +120,98 @@ namespace program
 
 		builder 
 			<< "Open MP { threads: " 
-			<< omp_get_max_threads() 
-			<< "}";
+			<< this->thread_count;
+
+		if (this->pinning != Thread_Pinning::None) 
+		{
+			builder << ", pinning: " << get_thread_pinning_name(this->pinning);
+
+			if (!this->is_pinned) builder << " (binding failed, threads are not pinned)";
+		}
+
+		builder << "}";
 
 		return builder.str();
 	}
+
+
+	std::string Algorithm_Configuration_OpenMP::get_runtime_info_text() const 
+	{
+		std::ostringstream builder;
+
+		if (this->is_collecting_statistics) 
+		{
+			if (auto * algorithm_openmp = dynamic_cast<quick_hull::Algorithm_OpenMP * >(this->algorithm)) 
+			{
+				builder << algorithm_openmp->get_statistics().get_text();
+			}
+		}
+
+		if (this->is_reporting_numa) 
+		{
+			// Root passes are summed per node of the cpus, which ran them
+			for (const auto & node : get_numa_nodes()) 
+			{
+				int    thread_count  = 0;
+				long   point_count   = 0;
+				double milliseconds  = 0;
+				int    page_count    = 0;
+				int    local_count   = 0;
+
+				for (const auto & scan : this->root_scans) 
+				{
+					if (scan.points == nullptr || std::find(node.cpus.begin(), node.cpus.end(), scan.cpu) == node.cpus.end()) continue;
+
+					thread_count++;
+					point_count  += scan.point_count;
+					milliseconds  = std::max(milliseconds, scan.milliseconds);
+
+					for (auto page_node : get_memory_nodes(scan.points, scan.point_count * sizeof(Vector2), 64)) 
+					{
+						page_count++;
+						local_count += page_node == node.node;
+					}
+				}
+
+				if (!builder.str().empty()) builder << "\n ";
+
+				builder 
+					<< "{ numa node: " << node.node 
+					<< ", cpus: " << node.cpus.size() 
+					<< ", threads: " << thread_count 
+					<< ", root points: " << point_count 
+					<< ", root ms: " << milliseconds 
+					<< ", local pages: ";
+
+				if (page_count > 0) builder << (100 * local_count / page_count) << "%";
+				else builder << "unknown";
+
+				builder << " }";
+			}
+		}
+
+		if (!this->trace_filepath.empty()) 
+		{
+			if (!builder.str().empty()) builder << "\n ";
+
+			builder 
+				<< "{ trace: " << this->trace_filepath 
+				<< ", dropped events: " << this->trace.get_dropped_event_count() << " }";
+		}
+
+		return builder.str();
+	}
+
+
+	void Algorithm_Configuration_OpenMP::export_runtime_data() const 
+	{
+		if (this->trace_filepath.empty()) return;
+
+		if (!this->trace.write_chrome_trace(this->trace_filepath)) 
+		{
+			program::panic_begin 
+				<< "Panic: could not write trace at path: " << this->trace_filepath << "." 
+				<< program::panic_end;
+		}
+	}
 }
\ No newline at end of file
@@ -2,6 +2,9 @@
 
 // internal
 #include "input_configuration.hpp"
+#include "topology.hpp"
+#include "algorithm/tracing.hpp"
+#include "algorithm/openmp.hpp"
 #include "./config_base.hpp"
 
 namespace program 
@@ -10,9 +13,19 @@ namespace program
 	{
 		private: // ..fields
 			int thread_count;
+			bool is_collecting_statistics;
+			std::string trace_filepath;   // ..empty when tracing is off
+			quick_hull::Task_Trace trace;
+			Thread_Pinning pinning;
+			bool is_pinned;               // ..false when binding the team to the pinning cpus failed
+			bool is_reporting_numa;
+			std::vector<quick_hull::Root_Scan> root_scans; // ..filled only when reporting numa
 
 		public: // ..methods
+			int get_thread_count() const override { return thread_count; }
 			std::string get_info_text() const override;
+			std::string get_runtime_info_text() const override;
+			void export_runtime_data() const override;
 			bool try_initialize(Input_Configuration input, bool allow_panic) override;
 	};
 }
\ No newline at end of file
@@ -13,7 +13,17 @@ namespace program
 		bool allow_panic
 	)
 	{
-		this->algorithm = new quick_hull::Algorithm_Sequential();
+		this->is_collecting_statistics = false;
+
+		for (auto iterator = Input_Configuration_Iterator(input); iterator.move_next();) 
+		{
+			if (iterator.is_argument(program_arguments_tag::statistics)) 
+			{
+				this->is_collecting_statistics = true;
+			}
+		}
+
+		this->algorithm = new quick_hull::Algorithm_Sequential(this->is_collecting_statistics);
 		return true;
 	}
 
@@ -21,4 +31,16 @@ namespace program
 	{
 		return "Sequentual";
 	}
+
+	std::string Algorithm_Configuration_Sequential::get_runtime_info_text() const 
+	{
+		if (!this->is_collecting_statistics) return std::string("");
+
+		if (auto * algorithm_sequential = dynamic_cast<quick_hull::Algorithm_Sequential * >(this->algorithm)) 
+		{
+			return algorithm_sequential->get_statistics().get_text();
+		}
+
+		return std::string("");
+	}
 }
\ No newline at end of file
@@ -8,8 +8,12 @@ namespace program
 {
 	struct Algorithm_Configuration_Sequential : public Algorithm_Configuration_Base
 	{
+		private: // ..fields
+			bool is_collecting_statistics;
+
 		public:// ..methods
 			std::string get_info_text() const override;
+			std::string get_runtime_info_text() const override;
 			bool try_initialize(Input_Configuration input, bool allow_panic) override;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,245 @@
+// standard
+#include <chrono>
+#include <fstream>
+#include <algorithm>
+
+// external
+#include "omp.h"
+
+#if __linux__
+	#include <glob.h>
+	#include <dirent.h>
+	#include <sys/stat.h>
+#endif
+
+// internal
+#include "io.hpp"
+#include "algorithm/sequential.hpp"
+#include "./constants.hpp"
+#include "./config_batch.hpp"
+#include "./config_computing.hpp"
+
+namespace program 
+{
+	// Returns size of the regular file (-1 when it is not one)
+	static long long get_file_size(const std::string & filepath)
+	{
+#if __linux__
+		struct stat status;
+
+		if (stat(filepath.c_str(), &status) != 0 || !S_ISREG(status.st_mode)) return -1;
+
+		return status.st_size;
+#else
+		std::ifstream input(filepath, std::ios::in | std::ios::binary | std::ios::ate);
+
+		return input.fail() ? -1 : (long long)input.tellg();
+#endif
+	}
+
+	static void compute_batch_file(quick_hull::Algorithm & executor, Batch_File_Result & result)
+	{
+		auto stopwatch_start = std::chrono::steady_clock::now();
+
+		result.point_count = 0;
+		// ..read_points would stop the whole batch on a missing file or one, which can not be opened (e.g. without permission)
+		result.is_read = result.file_size >= 0 && std::ifstream(result.filepath, std::ios::in | std::ios::binary).good();
+
+		if (result.is_read) 
+		{
+			Point_Buffer points;
+			read_points(result.filepath, points);
+
+			result.point_count = points.size();
+
+			if (!points.empty()) 
+			{
+				auto * convex_hull = executor.run(points);
+				result.convex_hull.swap(*convex_hull);
+				delete convex_hull;
+			}
+		}
+
+		auto stopwatch_end = std::chrono::steady_clock::now();
+
+		result.milliseconds = std::chrono::duration<double, std::milli>(stopwatch_end - stopwatch_start).count();
+	}
+
+
+	std::vector<std::string> Application_Configuration_Batch::list_batch_files(const std::string & source)
+	{
+		std::vector<std::string> filepaths;
+
+#if __linux__
+		struct stat status;
+		bool is_directory = stat(source.c_str(), &status) == 0 && S_ISDIR(status.st_mode);
+
+		if (is_directory) 
+		{
+			if (DIR * directory = opendir(source.c_str())) 
+			{
+				while (auto * entry = readdir(directory))
+				{
+					std::string filepath = source + "/" + entry->d_name;
+
+					if (get_file_size(filepath) >= 0) filepaths.push_back(filepath);
+				}
+
+				closedir(directory);
+			}
+
+			std::sort(filepaths.begin(), filepaths.end());
+			return filepaths;
+		}
+
+		if (source.find_first_of("*?[") != std::string::npos) 
+		{
+			glob_t matches;
+
+			if (glob(source.c_str(), 0, nullptr, &matches) == 0) 
+			{
+				for (size_t index = 0; index < matches.gl_pathc; index++) filepaths.push_back(matches.gl_pathv[index]);
+			}
+
+			globfree(&matches);
+			return filepaths; // ..glob sorts the matches
+		}
+#endif
+
+		// Manifest: one filepath per line (empty lines are skipped)
+		std::ifstream input(source);
+		std::string line;
+
+		if (input.fail())
+		{
+			program::panic_begin 
+				<< "Panic: could not open batch manifest at path: " << source << "." 
+				<< program::panic_end;
+		}
+
+		while (std::getline(input, line))
+		{
+			if (!line.empty() && line.back() == '\r') line.pop_back();
+			if (!line.empty()) filepaths.push_back(line);
+		}
+
+		return filepaths;
+	}
+
+
+	bool Application_Configuration_Batch::try_initialize
+	(
+		Input_Configuration input, 
+		bool allow_panic
+	)
+	{
+		std::string source;
+		bool is_mixed_precision = false;
+
+		this->output_filepath = "batch.out";
+
+		for (auto iterator = Input_Configuration_Iterator(input); iterator.move_next();) 
+		{
+			if (iterator.is_argument(program_arguments_tag::batch)) 
+			{
+				if (iterator.move_next()) 
+				{
+					source = iterator.get_argument_as_string();
+				}
+				else if (allow_panic) program::panic_begin << "Panic: batch directory, glob or manifest is missing!" << program::panic_end;
+			}
+			else
+			if (iterator.is_argument(program_arguments_tag::batch_output)) 
+			{
+				if (iterator.move_next()) 
+				{
+					this->output_filepath = iterator.get_argument_as_string();
+				}
+				else if (allow_panic) program::panic_begin << "Panic: batch output filepath is missing!" << program::panic_end;
+			}
+			else
+			if (iterator.is_argument(program_arguments_tag::mixed_precision)) 
+			{
+				is_mixed_precision = true;
+			}
+		}
+
+		if (source.empty()) return false;
+
+		this->filepaths = list_batch_files(source);
+		this->algorithm_config = select_algorithm_config(input, is_mixed_precision);
+
+		return true;
+	}
+
+	void Application_Configuration_Batch::execute(std::vector<Batch_File_Result> & results, double & result_ellapsed_milliseconds) const
+	{
+		auto stopwatch_start = std::chrono::steady_clock::now();
+
+		results.resize(this->filepaths.size());
+
+		std::vector<int> small_files;
+		std::vector<int> large_files;
+
+		for (int index = 0; index < this->filepaths.size(); index++)
+		{
+			auto & result = results[index];
+
+			result.filepath  = this->filepaths[index];
+			result.file_size = get_file_size(result.filepath);
+			result.is_large  = result.file_size >= batch_large_file_size;
+
+			(result.is_large ? large_files : small_files).push_back(index);
+		}
+
+		// 1. Small files: one file per thread of the team, larger ones first (so the last files do not keep a single thread busy)
+		std::sort(small_files.begin(), small_files.end(), [&](int left, int right) 
+		{
+			return results[left].file_size > results[right].file_size;
+		});
+
+		std::vector<quick_hull::Algorithm_Sequential> thread_algorithms(omp_get_max_threads());
+
+		#pragma omp parallel for schedule(dynamic, 1)
+		for (int order = 0; order < (int)small_files.size(); order++)
+		{
+			compute_batch_file(thread_algorithms[omp_get_thread_num()], results[small_files[order]]);
+		}
+
+		// 2. Large files: one after another, each by the whole team (of the selected engine)
+		for (auto index : large_files)
+		{
+			compute_batch_file(this->algorithm_config->get_executor_instance(), results[index]);
+		}
+
+		auto stopwatch_end = std::chrono::steady_clock::now();
+
+		result_ellapsed_milliseconds = std::chrono::duration<double, std::milli>(stopwatch_end - stopwatch_start).count();
+	}
+
+	void Application_Configuration_Batch::write_results(const std::vector<Batch_File_Result> & results) const
+	{
+		std::ofstream output(this->output_filepath, std::ios::out | std::ios::trunc);
+
+		if (output.fail())
+		{
+			program::panic_begin 
+				<< "Panic: could not open file at path: " << this->output_filepath << "." 
+				<< program::panic_end;
+		}
+
+		for (const auto & result : results)
+		{
+			output 
+				<< "# file: " << result.filepath 
+				<< ", status: " << (result.is_read ? "ok" : "unreadable") 
+				<< ", points: " << result.point_count 
+				<< ", hull: " << result.convex_hull.size() 
+				<< ", mode: " << (result.is_large ? "large" : "small") 
+				<< ", milliseconds: " << result.milliseconds 
+				<< "\n";
+
+			for (const auto & point : result.convex_hull) output << point.x << " " << point.y << "\n";
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+
+// standard
+#include <string>
+#include <vector>
+
+// internal
+#include "core.hpp"
+#include "input_configuration.hpp"
+#include "./config_base.hpp"
+#include "./algorithm/config_base.hpp"
+
+namespace program 
+{
+	// Files from this size are computed one after another by the selected engine (with its own parallelism),
+	// smaller ones are computed in parallel by the sequential engine (one thread each)
+	static const long long batch_large_file_size = 16 << 20;
+
+
+	// Convex hull of a single file of the batch
+	struct Batch_File_Result
+	{
+		public: // fields
+			std::string          filepath;
+			long long            file_size;
+			bool                 is_large;
+			bool                 is_read;      // ..false when the file could not be opened
+			long long            point_count;
+			double               milliseconds; // ..reading and computing
+			std::vector<Vector2> convex_hull;
+	};
+
+
+	// Computes hulls of many files in a single process: the Open MP team is created once and shared by all files
+	struct Application_Configuration_Batch : public Application_Configuration_Base
+	{
+		private: // ..fields
+			std::vector<std::string>       filepaths;
+			std::string                    output_filepath;
+			Algorithm_Configuration_Base * algorithm_config; // ..for large files
+
+		public: // ..getters
+			int get_file_count() const { return filepaths.size(); }
+			std::string get_output_filepath() const { return output_filepath; }
+			const Algorithm_Configuration_Base * get_algorithm_config() const { return algorithm_config; }
+
+		public: // ..methods
+			bool try_initialize(Input_Configuration input, bool allow_panic) override;
+
+			void execute(std::vector<Batch_File_Result> & results, double & result_ellapsed_milliseconds) const;
+
+			// Writes a summary line and the hull vertices of each file into the output file
+			void write_results(const std::vector<Batch_File_Result> & results) const;
+
+			// Lists files of the directory, the glob pattern or the manifest (one path per line)
+			static std::vector<std::string> list_batch_files(const std::string & source);
+	};
+}
\ No newline at end of file
@@ -1,23 +1,82 @@
 // standard
+#include <cmath>
+#include <csignal>
+#include <iostream>
 #include <chrono>
+#include <atomic>
+#include <thread>
+#include <algorithm>
 
 // internal
 #include "io.hpp"
+#include "allocation.hpp"
+#include "bounded_queue.hpp"
 #include "input_configuration.hpp"
+#include "algorithm/sequential.hpp"
+#include "algorithm/convex_layers.hpp"
+#include "algorithm/containment.hpp"
 #include "./constants.hpp"
 #include "./config_computing.hpp"
 #include "./algorithm/config_base.hpp"
 #include "./algorithm/config_sequential.hpp"
+#include "./algorithm/config_mixed_precision.hpp"
+#include "./algorithm/config_openmp.hpp"
 
-#if _OPENMP
-	#include "./algorithm/config_openmp.hpp"
-#elif __NVCC__
+#if __NVCC__
 	#include "./algorithm/config_cuda.hpp"
 #endif
 
 
 namespace program 
 {
+	// The run stopped by Ctrl+C (cancelling is lock-free, so it is safe in the handler)
+	static quick_hull::Run_Control * interrupted_run_control = nullptr;
+
+	static void handle_interrupt(int signal)
+	{
+		if (interrupted_run_control != nullptr) interrupted_run_control->cancel();
+	}
+
+
+	Algorithm_Configuration_Base * select_algorithm_config(Input_Configuration input, bool is_mixed_precision)
+	{
+		// 1. Selects the first engine, which accepts the input
+		std::vector<Algorithm_Configuration_Base *> algorithm_configs;
+#if __NVCC__
+		algorithm_configs.push_back(new Algorithm_Configuration_Cuda());
+#endif
+		algorithm_configs.push_back(new Algorithm_Configuration_OpenMP());
+
+		Algorithm_Configuration_Base * algorithm_config_selected = nullptr;
+
+		for (auto * algorithm_config : algorithm_configs)
+		{
+			if (algorithm_config_selected == nullptr && algorithm_config->try_initialize(input, false)) 
+			{
+				algorithm_config_selected = algorithm_config;
+			}
+			else delete algorithm_config; // ..deletes unused algorithm configurations
+		}
+
+		if (algorithm_config_selected == nullptr) // ..by default the sequential implementtion is used
+		{
+			algorithm_config_selected = new Algorithm_Configuration_Sequential();
+			algorithm_config_selected->try_initialize(input, true); // ..if even sequential algoirhtm fails to initialize the program should not conntinue its execution
+		}
+
+
+		// 2. Wraps the algorithm into the float32 filter (if requested), the wrapper owns the selected configuration
+		if (is_mixed_precision) 
+		{
+			auto algorithm_config_mixed_precision = new Algorithm_Configuration_Mixed_Precision(algorithm_config_selected);
+			algorithm_config_mixed_precision->try_initialize(input, true);
+			algorithm_config_selected = algorithm_config_mixed_precision;
+		}
+
+		return algorithm_config_selected;
+	}
+
+
 	bool Application_Configuration_Computing::try_initialize
 	(
 		Input_Configuration input, 
@@ -26,15 +85,117 @@ namespace program
 	{
 		// 1. Looks at input
 
-		std::string points_filepath;
+		this->is_capturing_counters = false;
+		this->is_validating = false;
+		this->is_pipelined = false;
+		this->points_filepath.clear();
+		this->deadline_milliseconds = -1;
+		this->is_reporting_progress = false;
+		this->is_keeping_partial_hull = false;
+		this->query = quick_hull::Hull_Query();
+		this->is_computing_layers = false;
+		this->is_measuring_hull = false;
+		this->query_filepath.clear();
+		bool is_mixed_precision = false;
 
 		for(auto iterator = Input_Configuration_Iterator(input); iterator.move_next();) 
 		{
+			if (iterator.is_argument(program_arguments_tag::perf_counters)) 
+			{
+				this->is_capturing_counters = true;
+			}
+			else
+			if (iterator.is_argument(program_arguments_tag::validate)) 
+			{
+				this->is_validating = true;
+			}
+			else
+			if (iterator.is_argument(program_arguments_tag::mixed_precision)) 
+			{
+				is_mixed_precision = true;
+			}
+			else
+			if (iterator.is_argument(program_arguments_tag::pipelined)) 
+			{
+				this->is_pipelined = true;
+			}
+			else
+			if (iterator.is_argument(program_arguments_tag::deadline)) 
+			{
+				if (iterator.move_next())
+				{
+					this->deadline_milliseconds = iterator.get_argument_as_double();
+				}
+				
+				if (this->deadline_milliseconds < 0 && allow_panic)
+				{
+					program::panic_begin << "Panic: deadline milliseconds are missing or negative!" << program::panic_end;
+				}
+			}
+			else
+			if (iterator.is_argument(program_arguments_tag::progress)) 
+			{
+				this->is_reporting_progress = true;
+			}
+			else
+			if (iterator.is_argument(program_arguments_tag::partial_hull)) 
+			{
+				this->is_keeping_partial_hull = true;
+			}
+			else
+			if (iterator.is_argument(program_arguments_tag::convex_layers)) 
+			{
+				this->is_computing_layers = true;
+			}
+			else
+			if (iterator.is_argument(program_arguments_tag::calipers)) 
+			{
+				this->is_measuring_hull = true;
+			}
+			else
+			if (iterator.is_argument(program_arguments_tag::query_file)) 
+			{
+				if (iterator.move_next())
+				{
+					this->query_filepath = iterator.get_argument_as_string();
+				}
+				else if (allow_panic)
+				{
+					program::panic_begin << "Panic: query filepath is undefined!" << program::panic_end;
+				}
+			}
+			else
+			if (iterator.is_argument(program_arguments_tag::hull_part)) 
+			{
+				quick_hull::Hull_Part part;
+
+				if (!iterator.move_next() || !quick_hull::try_parse_hull_part(iterator.get_argument_as_string(), part)) 
+				{
+					if (allow_panic) program::panic_begin << "Panic: hull part is missing or unknown (upper, lower or sector)!" << program::panic_end;
+				}
+				else
+				if (part == quick_hull::Hull_Part::Sector) 
+				{
+					double degrees_begin = 0, degrees_end = -1;
+
+					if (iterator.move_next()) degrees_begin = iterator.get_argument_as_double();
+					if (iterator.move_next()) degrees_end   = iterator.get_argument_as_double();
+
+					if (degrees_end < degrees_begin) 
+					{
+						if (allow_panic) program::panic_begin << "Panic: hull sector needs begin and end degrees (end not less than begin)!" << program::panic_end;
+					}
+
+					this->query = quick_hull::Hull_Query(degrees_begin * M_PI / 180, degrees_end * M_PI / 180);
+				}
+				else this->query = quick_hull::Hull_Query(part);
+			}
+			else
 			if (iterator.is_argument(program_arguments_tag::points_filepath)) 
 			{
 				if (iterator.move_next())
 				{
-					points_filepath = iterator.get_argument_as_string();
+					this->points_filepath = iterator.get_argument_as_string();
 				}
 				else if (allow_panic)
 				{
@@ -44,46 +205,45 @@ namespace program
 		};
 
 
-		// 2. Reads points
-
-		if (points_filepath.empty()) 
+		if (this->points_filepath.empty()) 
 		{
 			return false;
 		}
 
-		read_points(points_filepath, this->points);
-
-
-		// 3.1 Selects algorithm
-
-#if _OPENMP
-		auto algorithm_config_openmp = new Algorithm_Configuration_OpenMP();
-		if (algorithm_config_openmp->try_initialize(input, false)) 
+		if (this->is_computing_layers && (this->is_pipelined || !this->query.is_all()) && allow_panic) 
 		{
-			this->algorithm_config = algorithm_config_openmp;
+			program::panic_begin << "Panic: convex layers need all points and the full hull (not pipelined nor a hull part)!" << program::panic_end;
 		}
-#elif __NVCC__
-		auto algorithm_config_cuda = new Algorithm_Configuration_Cuda();
-		if(algorithm_config_cuda->try_initialize(input, false))
+
+		if (this->is_measuring_hull && (this->is_computing_layers || !this->query.is_all()) && allow_panic) 
 		{
-			this->algorithm_config = algorithm_config_cuda;
+			program::panic_begin << "Panic: calipers measure the full hull (not convex layers nor a hull part)!" << program::panic_end;
 		}
-#else
-		if (false) { }
-#endif
-		else // ..by default the sequential implementtion is used
+
+		if (!this->query_filepath.empty() && (this->is_computing_layers || !this->query.is_all()) && allow_panic) 
 		{
-			this->algorithm_config = new Algorithm_Configuration_Sequential();
-			this->algorithm_config->try_initialize(input, true); // ..if even sequential algoirhtm fails to initialize the program should not conntinue its execution
+			program::panic_begin << "Panic: query points are classified against the full hull (not convex layers nor a hull part)!" << program::panic_end;
 		}
 
 
-		// 3.2 Deletes unused algorithm configurations (if any)
-#if _OPENMP
-		if (this->algorithm_config != algorithm_config_openmp) delete algorithm_config_openmp;
-#elif __NVCC__
-		if (this->algorithm_config != algorithm_config_cuda) delete algorithm_config_cuda;
-#endif
+		// 2. Selects algorithm at runtime
+		this->algorithm_config = select_algorithm_config(input, is_mixed_precision);
+
+
+		// 3. Reads points (after the algorithm, so its pinned threads first touch the buffer), 
+		// pipelined computing reads them during the computing
+		this->point_count = 0;
+
+		if (this->is_pipelined) return true;
+
+		if (is_memory_accounting_enabled()) read_memory.begin();
+		if (this->is_capturing_counters) read_counters.start(this->algorithm_config->get_thread_count());
+
+		read_points(this->points_filepath, this->points, this->algorithm_config->get_thread_count());
+		this->point_count = this->points.size();
+
+		if (this->is_capturing_counters) read_counters.stop();
+		if (is_memory_accounting_enabled()) read_memory.end();
 
 		return true;
 	}
@@ -92,20 +252,62 @@ namespace program
 	(
 		std::vector<Vector2> & result_convex_hull,
 		double               & result_ellapsed_milliseconds,
-		std::ostringstream   & result_runtime_info_buffer
+		std::ostringstream   & result_runtime_info_buffer,
+		Hardware_Counters_Session * result_counters
 	)
-	const
 	{
 		auto & executor = this->algorithm_config->get_executor_instance();
 
+		// Stops the run by the deadline or by Ctrl+C, progress of a pipelined run would restart with each block
+		if (this->deadline_milliseconds >= 0) run_control.set_deadline(this->deadline_milliseconds);
+
+		if (this->is_reporting_progress && !this->is_pipelined) 
+		{
+			run_control.set_progress_callback([](double fraction) 
+			{
+				std::cerr << "\rProgress: " << (int)(fraction * 100) << "%" << std::flush;
+			});
+		}
+
+		executor.set_control(&run_control);
+		executor.set_query(this->query);
+		interrupted_run_control = &run_control;
+		auto previous_interrupt_handler = std::signal(SIGINT, handle_interrupt);
+
+		if (result_counters != nullptr) result_counters->start(this->algorithm_config->get_thread_count());
+
 		// Captures computing start time
 		auto stopwatch_start = std::chrono::steady_clock::now();
 
-		auto * convex_hull = executor.run(points);
+		std::ostringstream pipeline_info;
+		std::vector<Vector2> * convex_hull;
+
+		// ..layers are written into the result one after another
+		quick_hull::Algorithm_Convex_Layers layers_algorithm(this->algorithm_config->get_thread_count());
+
+		if (this->is_computing_layers) 
+		{
+			layers_algorithm.set_control(&run_control);
+			layers_algorithm.compute_layers(points, this->layers);
+
+			convex_hull = new std::vector<Vector2>(this->layers.vertices);
+		}
+		else convex_hull = this->is_pipelined ? run_pipeline(executor, pipeline_info) : executor.run(points);
 
 		// Captures computing end time
 		auto stopwatch_end = std::chrono::steady_clock::now();
 
+		if (result_counters != nullptr) result_counters->stop();
+
+		std::signal(SIGINT, previous_interrupt_handler);
+		interrupted_run_control = nullptr;
+		executor.set_control(nullptr);
+
+		if (this->is_reporting_progress && !this->is_pipelined) std::cerr << std::endl;
+
+		// ..a stopped run has a partial hull (true hull vertices found before the stop)
+		if (run_control.was_stopped() && !this->is_keeping_partial_hull) convex_hull->clear();
+
 		// Computes computing ellapsed milliseconds
 		result_ellapsed_milliseconds = std::chrono::duration<double, std::milli>
 		(
@@ -113,15 +315,257 @@ namespace program
 		)
 		.count(); 
 
-		// Copies computing result into the output result
-		for (int index = 0; index < convex_hull->size(); index++) 
+		// Moves computing result into the output result (without copying)
+		result_convex_hull.swap(*convex_hull);
+
+		this->algorithm_config->export_runtime_data();
+
+		if (this->is_computing_layers) 
 		{
-			Vector2 point = convex_hull->at(index);
-			result_convex_hull.push_back(point);
+			result_runtime_info_buffer 
+				<< "{ convex layers: " << this->layers.get_layer_count() 
+				<< ", certificates: " << layers_algorithm.get_certificate_count() 
+				<< ", processed points: " << layers_algorithm.get_processed_point_count() 
+				<< " (" << (double)layers_algorithm.get_processed_point_count() / std::max((size_t)1, points.size()) << " per point) }";
 		}
+		else result_runtime_info_buffer << this->algorithm_config->get_runtime_info_text();
 
-		result_runtime_info_buffer << this->algorithm_config->get_runtime_info_text();
+		if (this->is_pipelined) 
+		{
+			if (result_runtime_info_buffer.tellp() > 0) result_runtime_info_buffer << "\n ";
+
+			result_runtime_info_buffer << pipeline_info.str();
+		}
+
+		if (get_huge_page_mode() != Huge_Page_Mode::Off) 
+		{
+			if (result_runtime_info_buffer.tellp() > 0) result_runtime_info_buffer << "\n ";
+
+			result_runtime_info_buffer << get_huge_page_usage().get_text();
+		}
+
+		if (!this->query.is_all()) 
+		{
+			if (result_runtime_info_buffer.tellp() > 0) result_runtime_info_buffer << "\n ";
+
+			result_runtime_info_buffer << "{ hull part: " << quick_hull::get_hull_part_name(this->query.part);
+
+			if (this->query.is_sector()) 
+			{
+				result_runtime_info_buffer << " " << this->query.sector_begin * 180 / M_PI << ".." << this->query.sector_end * 180 / M_PI << " degrees";
+			}
+
+			result_runtime_info_buffer << " }";
+		}
+
+		// Post-processing stage: rotating calipers over the hull (not counted in the algorithm time), a partial hull is not measured
+		if (this->is_measuring_hull && !run_control.was_stopped()) 
+		{
+			auto measure_start = std::chrono::steady_clock::now();
+
+			this->measures = quick_hull::measure_convex_hull(result_convex_hull);
+
+			auto measure_end = std::chrono::steady_clock::now();
+
+			if (result_runtime_info_buffer.tellp() > 0) result_runtime_info_buffer << "\n ";
+
+			result_runtime_info_buffer 
+				<< "{ calipers: { diameter: " << this->measures.diameter 
+				<< ", width: " << this->measures.width 
+				<< ", min area rectangle: " << this->measures.min_area_rectangle.area 
+				<< ", min perimeter rectangle: " << this->measures.min_perimeter_rectangle.perimeter 
+				<< ", milliseconds: " << std::chrono::duration<double, std::milli>(measure_end - measure_start).count() << " } }";
+		}
+
+		// Post-processing stage: containment queries of the query file against the hull (the hull is indexed once)
+		if (!this->query_filepath.empty() && !run_control.was_stopped()) 
+		{
+			auto query_start = std::chrono::steady_clock::now();
+
+			quick_hull::Hull_Containment containment(result_convex_hull);
+			std::atomic<long long> inside_count(0);
+
+			long long query_count = scan_points_mapped
+			(
+				this->query_filepath, 
+				[&](const Vector2 * query_points, int count) { inside_count += containment.count_inside(query_points, count); }, 
+				this->algorithm_config->get_thread_count()
+			);
+
+			double query_milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - query_start).count();
+
+			if (result_runtime_info_buffer.tellp() > 0) result_runtime_info_buffer << "\n ";
+
+			result_runtime_info_buffer 
+				<< "{ queries: " << query_count 
+				<< ", inside: " << inside_count.load() 
+				<< ", milliseconds: " << query_milliseconds 
+				<< " (" << query_count / std::max(query_milliseconds / 1000, 1e-9) << " points per second) }";
+		}
+
+		if (run_control.was_stopped()) 
+		{
+			if (result_runtime_info_buffer.tellp() > 0) result_runtime_info_buffer << "\n ";
+
+			result_runtime_info_buffer 
+				<< "{ stopped: " << (run_control.was_deadline_reached() ? "deadline" : "cancelled")
+				<< ", partial hull: " << (this->is_keeping_partial_hull ? "kept" : "dropped") << " }";
+		}
 
 		delete convex_hull;
 	}
+	std::vector<Vector2> * Application_Configuration_Computing::run_pipeline
+	(
+		quick_hull::Algorithm & executor, 
+		std::ostringstream    & result_runtime_info_buffer
+	)
+	{
+		Points_Block_Reader reader(this->points_filepath, pipeline_block_size);
+		Bounded_Queue<std::string> queue(pipeline_queue_capacity);
+
+		double reader_milliseconds       = 0; // ..reading (without waiting)
+		double reader_wait_milliseconds  = 0; // ..waiting for the computing stage (a full queue)
+		double compute_wait_milliseconds = 0; // ..waiting for the reader stage (an empty queue)
+		int    block_count               = 0;
+
+		// Reader stage
+		std::thread reader_thread([&]() 
+		{
+			while (true) 
+			{
+				std::string text;
+
+				auto stopwatch_start = std::chrono::steady_clock::now();
+				bool is_read = reader.read_block(text);
+				auto stopwatch_middle = std::chrono::steady_clock::now();
+
+				if (!is_read) break;
+
+				queue.push(std::move(text));
+				auto stopwatch_end = std::chrono::steady_clock::now();
+
+				reader_milliseconds      += std::chrono::duration<double, std::milli>(stopwatch_middle - stopwatch_start).count();
+				reader_wait_milliseconds += std::chrono::duration<double, std::milli>(stopwatch_end - stopwatch_middle).count();
+			}
+
+			queue.close();
+		});
+
+		// Computing stage: hull vertices of the blocks are collected and folded into the running hull, when they are 
+		// four times as many (so hulls with most of the points on them are not computed again for each block)
+		Point_Buffer block_points;
+		Point_Buffer hull_points;
+		size_t       folded_count = 0; // ..hull points after the last folding
+		int          fold_count   = 0;
+		std::string  text;
+
+		auto fold = [&]() 
+		{
+			auto * convex_hull = executor.run(hull_points);
+
+			hull_points.assign(convex_hull->begin(), convex_hull->end());
+			folded_count = hull_points.size();
+			fold_count++;
+
+			delete convex_hull;
+		};
+
+		size_t point_limit = std::max(0L, reader.get_point_count()); // ..a file may have more lines than its point count
+
+		this->points.clear();
+		this->point_count = 0;
+
+		while (true)
+		{
+			auto stopwatch_start = std::chrono::steady_clock::now();
+			bool is_popped = queue.pop(text);
+			auto stopwatch_end = std::chrono::steady_clock::now();
+
+			compute_wait_milliseconds += std::chrono::duration<double, std::milli>(stopwatch_end - stopwatch_start).count();
+
+			if (!is_popped) break;
+
+			// ..after a stop the rest of the blocks are only drained (so the reader thread finishes)
+			if (run_control.should_stop()) continue;
+
+			parse_points_text(text, block_points, this->algorithm_config->get_thread_count());
+			block_points.resize(std::min(block_points.size(), point_limit - (size_t)this->point_count));
+
+			this->point_count += block_points.size();
+			block_count++;
+
+			if (this->is_validating) this->points.insert(this->points.end(), block_points.begin(), block_points.end());
+
+			if (block_points.empty()) continue;
+
+			auto * block_hull = executor.run(block_points);
+			hull_points.insert(hull_points.end(), block_hull->begin(), block_hull->end());
+			delete block_hull;
+
+			if (hull_points.size() > 4 * folded_count) fold();
+		}
+
+		reader_thread.join();
+
+		// ..after a stop the collected points are still folded completely (into the hull of the blocks computed before the stop)
+		if (run_control.was_stopped()) executor.set_control(nullptr);
+
+		if (hull_points.size() > folded_count) fold();
+
+		result_runtime_info_buffer 
+			<< "{ pipeline blocks: " << block_count 
+			<< ", folds: " << fold_count 
+			<< ", reading: " << reader_milliseconds << " ms"
+			<< ", reader waiting: " << reader_wait_milliseconds << " ms"
+			<< ", computing waiting: " << compute_wait_milliseconds << " ms }";
+
+		return new std::vector<Vector2>(hull_points.begin(), hull_points.end());
+	}
+
+	void Application_Configuration_Computing::validate_convex_hull
+	(
+		const std::vector<Vector2>         & convex_hull,
+		quick_hull::Hull_Validation_Result & result_validation,
+		double                             & result_ellapsed_milliseconds
+	)
+	const
+	{
+		auto stopwatch_start = std::chrono::steady_clock::now();
+
+		if (this->is_computing_layers) 
+		{
+			result_validation = quick_hull::validate_convex_layers(this->layers, points);
+		}
+		else
+		if (this->query.is_all()) 
+		{
+			result_validation = quick_hull::validate_convex_hull(convex_hull, points);
+		}
+		else 
+		{
+			// ..the full hull is computed by the sequential engine and validated first
+			quick_hull::Algorithm_Sequential reference;
+			auto * full_convex_hull = reference.run(points);
+
+			result_validation = quick_hull::validate_convex_hull(*full_convex_hull, points);
+
+			quick_hull::select_hull_part(*full_convex_hull, this->query);
+
+			if (result_validation.is_valid && *full_convex_hull != convex_hull) 
+			{
+				result_validation.is_valid = false;
+				result_validation.error = "the hull part differs from the same part of the full hull";
+			}
+
+			delete full_convex_hull;
+		}
+
+		auto stopwatch_end = std::chrono::steady_clock::now();
+
+		result_ellapsed_milliseconds = std::chrono::duration<double, std::milli>
+		(
+			stopwatch_end - stopwatch_start
+		)
+		.count(); 
+	}
 }
\ No newline at end of file
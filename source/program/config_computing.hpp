@@ -2,20 +2,61 @@
 
 // internal
 #include "input_configuration.hpp"
+#include "performance_counters.hpp"
+#include "memory_accounting.hpp"
+#include "algorithm/validation.hpp"
+#include "algorithm/calipers.hpp"
 
 #include "./config_base.hpp"
 #include "./algorithm/config_base.hpp"
 
 namespace program 
 {
+	// Pipelined computing reads blocks of this size while the previous ones are parsed and computed
+	static const size_t pipeline_block_size     = 4 << 20;
+	static const size_t pipeline_queue_capacity = 4;
+
+
+	// Selects the algorithm at runtime: the first engine, which accepts the input (sequential by default).
+	// The float32 filter wraps it, when asked.
+	extern Algorithm_Configuration_Base * select_algorithm_config(Input_Configuration input, bool is_mixed_precision);
+
+
 	struct Application_Configuration_Computing : public Application_Configuration_Base 
 	{
 		private: // ..fields
-			std::vector<Vector2>           points;
+			Point_Buffer                   points;            // ..when pipelined, kept only for validation
 			Algorithm_Configuration_Base * algorithm_config;
+			bool                           is_capturing_counters;
+			bool                           is_validating;
+			bool                           is_pipelined;
+			std::string                    points_filepath;
+			long long                      point_count;
+			quick_hull::Run_Control        run_control;
+			double                         deadline_milliseconds; // ..negative when there is no deadline
+			bool                           is_reporting_progress;
+			bool                           is_keeping_partial_hull;
+			quick_hull::Hull_Query         query;
+			bool                           is_computing_layers;
+			quick_hull::Convex_Layers      layers;                // ..of the last computing
+			bool                           is_measuring_hull;
+			quick_hull::Hull_Measures      measures;              // ..of the last computed hull
+			std::string                    query_filepath;        // ..points classified against the hull (if any)
+			Hardware_Counters_Session      read_counters;
+			Memory_Phase                   read_memory;
 
 		public: // ..getters
-			int get_point_count() { return points.size(); }
+			long long get_point_count() const { return point_count; } // ..known after computing when pipelined
+			bool get_is_pipelined() const { return is_pipelined; }
+			bool get_is_computing_layers() const { return is_computing_layers; }
+			const quick_hull::Convex_Layers & get_layers() const { return layers; }
+			bool get_is_measuring_hull() const { return is_measuring_hull; }
+			const quick_hull::Hull_Measures & get_measures() const { return measures; }
+			bool get_is_capturing_counters() const { return is_capturing_counters; }
+			bool get_is_validating() const { return is_validating; }
+			bool get_was_stopped() const { return run_control.was_stopped(); } // ..the computed hull is partial (or dropped)
+			const Hardware_Counters_Session & get_read_counters() const { return read_counters; }
+			const Memory_Phase & get_read_memory() const { return read_memory; }
 			const Algorithm_Configuration_Base * get_algorithm_config() 
 			{ 
 				return algorithm_config;
@@ -28,7 +69,22 @@ namespace program
 			(
 				std::vector<Vector2> & result_convex_hull, 
 				double               & result_ellapsed_milliseconds,
-				std::ostringstream   & result_runtime_info_buffer
+				std::ostringstream   & result_runtime_info_buffer,
+				Hardware_Counters_Session * result_counters = nullptr // ..captured around the algorithm run (if any)
+			);
+
+			// Validates the convex hull against the read points (a part of the hull against the same part of the full hull, 
+			// layers by their nesting)
+			void validate_convex_hull
+			(
+				const std::vector<Vector2>         & convex_hull,
+				quick_hull::Hull_Validation_Result & result_validation,
+				double                             & result_ellapsed_milliseconds
 			) const;
+
+		private: // ..methods
+			// Reads blocks of the file in a reader thread, while this thread parses each block 
+			// and folds it into the running hull (the hull of the block points and of the previous hull)
+			std::vector<Vector2> * run_pipeline(quick_hull::Algorithm & executor, std::ostringstream & result_runtime_info_buffer);
 	};
 }
\ No newline at end of file
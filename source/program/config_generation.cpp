@@ -56,7 +56,7 @@ namespace program
 
 	void Application_Configuration_Points_Generation::execute
 	(
-		std::vector<Vector2> & result
+		Point_Buffer & result
 	) 
 	const
 	{
@@ -23,6 +23,6 @@ namespace program
 			
 		public: // methods
 			bool try_initialize(Input_Configuration input, bool allow_panic) override;
-			void execute(std::vector<Vector2> & result) const;
+			void execute(Point_Buffer & result) const;
 	};
 }
\ No newline at end of file
@@ -11,10 +11,32 @@
 
 namespace points_generation 
 {
-	void Configuration_Generation_Circle::execute(std::vector<Vector2> & result, int count) const
+	Configuration_Generation_Circle::Configuration_Generation_Circle() : 
+		center(0, 0), 
+		inner_radius(0), 
+		outer_radius(1), 
+		seed(0)
+	{
+	}
+
+	Configuration_Generation_Circle::Configuration_Generation_Circle
+	(
+		Vector2 center, 
+		double outer_radius, 
+		double inner_radius, 
+		unsigned int seed
+	) : 
+		center(center), 
+		inner_radius(inner_radius), 
+		outer_radius(outer_radius), 
+		seed(seed)
+	{
+	}
+
+	void Configuration_Generation_Circle::execute(Point_Buffer & result, int count) const
 	{
 		std::random_device random_device;
-		std::mt19937 generator(random_device());
+		std::mt19937 generator(seed != 0 ? seed : random_device());
 		std::uniform_real_distribution<double> position_distribution(-1.0, 1.0);
 		std::uniform_real_distribution<double> distance_distribution( 0.0, 1.0);
 
@@ -12,7 +12,7 @@ namespace points_generation
 	struct Configuration_Generation_Base : public program::Configuration_Base
 	{
 		public:
-			virtual void execute(std::vector<Vector2> & result, int count) const = 0;
+			virtual void execute(Point_Buffer & result, int count) const = 0;
 	};
 
 
@@ -22,9 +22,14 @@ namespace points_generation
 			Vector2 center;
 			double inner_radius;
 			double outer_radius;
+			unsigned int seed; // ..zero means a non-deterministic seed
 		
+		public: // constructors
+			Configuration_Generation_Circle();
+			Configuration_Generation_Circle(Vector2 center, double outer_radius, double inner_radius, unsigned int seed);
+
 		public:
 			bool try_initialize(program::Input_Configuration input, bool allow_panic) override;
-			void execute(std::vector<Vector2> & result, int count) const override;
+			void execute(Point_Buffer & result, int count) const override;
 	};
 }
\ No newline at end of file
@@ -1,13 +1,21 @@
 // standard
 #include <chrono>
 
+// external
+#include "omp.h"
+
 // internal
 #include "io.hpp"
+#include "allocation.hpp"
+#include "memory_accounting.hpp"
+#include "algorithm/kernels.hpp"
 #include "./config_program.hpp"
 #include "./config_computing.hpp"
 #include "./config_generation.hpp"
+#include "./config_thread_sweep.hpp"
+#include "./config_sharded.hpp"
+#include "./config_batch.hpp"
 #include "./algorithm/config_base.hpp"
-#include "./algorithm/config_cuda.hpp"
 #include "./algorithm/config_openmp.hpp"
 #include "./algorithm/config_sequential.hpp"
 #include "./constants.hpp"
@@ -30,6 +38,37 @@ namespace program
 			{
 				this->log_mode = Log_Mode::Verbose;
 			}
+			if (iterator.is_argument(program_arguments_tag::memory_stats)) 
+			{
+				program::enable_memory_accounting(); // ..as early as possible, so every later allocation is counted
+			}
+			if (iterator.is_argument(program_arguments_tag::kernel_isa)) 
+			{
+				quick_hull::Kernel_Isa isa;
+
+				if (!iterator.move_next()) 
+				{
+					if (allow_panic) program::panic_begin << "Panic: kernel instruction set is undefined!" << program::panic_end;
+				}
+				else if (!quick_hull::try_parse_kernel_isa(iterator.get_argument_as_string(), isa) || !quick_hull::set_kernel_isa(isa)) 
+				{
+					if (allow_panic) program::panic_begin << "Panic: kernel instruction set is not supported: " << iterator.get_argument_as_string() << "." << program::panic_end;
+				}
+			}
+			if (iterator.is_argument(program_arguments_tag::huge_pages)) 
+			{
+				Huge_Page_Mode mode;
+
+				if (!iterator.move_next()) 
+				{
+					if (allow_panic) program::panic_begin << "Panic: huge pages mode is undefined!" << program::panic_end;
+				}
+				else if (!try_parse_huge_page_mode(iterator.get_argument_as_string(), mode)) 
+				{
+					if (allow_panic) program::panic_begin << "Panic: unknown huge pages mode: " << iterator.get_argument_as_string() << "." << program::panic_end;
+				}
+				else set_huge_page_mode(mode); // ..before any point buffer is allocated
+			}
 			if (iterator.is_argument(program_arguments_tag::help)) 
 			{
 				program::print_help();
@@ -40,12 +79,32 @@ namespace program
 
 		auto application_computing = new Application_Configuration_Computing();
 		auto application_generation = new Application_Configuration_Points_Generation();
+		auto application_thread_sweep = new Application_Configuration_Thread_Sweep();
+		auto application_shard_worker = new Application_Configuration_Shard_Worker();
+		auto application_sharded = new Application_Configuration_Sharded();
+		auto application_batch = new Application_Configuration_Batch();
 		
 		// * Defines application
 		if (application_generation->try_initialize(input, allow_panic))
 		{
 			this->application = application_generation;
 		}
+		else if (application_thread_sweep->try_initialize(input, allow_panic)) 
+		{
+			this->application = application_thread_sweep;
+		}
+		else if (application_shard_worker->try_initialize(input, allow_panic)) 
+		{
+			this->application = application_shard_worker;
+		}
+		else if (application_sharded->try_initialize(input, allow_panic)) 
+		{
+			this->application = application_sharded;
+		}
+		else if (application_batch->try_initialize(input, allow_panic)) 
+		{
+			this->application = application_batch;
+		}
 		else if (application_computing->try_initialize(input, allow_panic)) 
 		{
 			this->application = application_computing;
@@ -58,12 +117,63 @@ namespace program
 		
 		if (this->application != application_computing) delete application_computing;
 		if (this->application != application_generation) delete application_generation;
+		if (this->application != application_thread_sweep) delete application_thread_sweep;
+		if (this->application != application_shard_worker) delete application_shard_worker;
+		if (this->application != application_sharded) delete application_sharded;
+		if (this->application != application_batch) delete application_batch;
 
 
 		return true;
 	}
 
 
+	// Prints the convex hull size and its vertices (only their hash when quiet), returns the hash
+	static size_t log_convex_hull(const std::vector<Vector2> & convex_hull, Log_Mode log_mode)
+	{
+		bool log_is_quiet = log_mode == Log_Mode::Quiet;
+		bool log_is_verbose = log_mode == Log_Mode::Verbose;
+
+		// Prints number of points
+		if(log_is_verbose || log_is_quiet)
+		{
+			program::log_begin
+				<< "Convex Hull: " << convex_hull.size() << "."
+				<< program::log_end;
+		}
+		else // prints raw number of convex hull points
+		{
+			program::log_begin << convex_hull.size() << program::log_end;
+		}
+
+
+		size_t convex_hull_hash = 0;
+
+		for (int index = 0; index < convex_hull.size(); index++)
+		{
+			auto &point = convex_hull.at(index);
+			
+			if (log_is_verbose)
+			{
+				program::log_begin 
+					<< "\t{ x: " << point.x << ", y: " << point.y << " }" 
+					<< program::log_end;
+			}
+			else if(log_is_quiet) 
+			{
+				convex_hull_hash ^= point.get_hash() << 1;
+			}
+			else // prints a raw point coordinates
+			{
+				program::log_begin 
+					<< point.x << " " << point.y 
+					<< program::log_end;
+			}
+		}
+
+		return convex_hull_hash;
+	}
+
+
 	void Configuration_Program::execute_application() const
 	{
 		bool log_is_quiet = this->log_mode == Log_Mode::Quiet;
@@ -83,7 +193,7 @@ namespace program
 					<< program::log_end;
 			}
 
-			std::vector<Vector2> points;
+			Point_Buffer points;
 			application_points_generation->execute(points);
 
 			if (log_is_verbose || log_is_quiet)
@@ -101,63 +211,248 @@ namespace program
 			program::write_points(application_points_generation->get_output_filepath(), points);
 		}
 		else
-		if (auto application_computing = dynamic_cast<Application_Configuration_Computing*>(application)) 
+		if (auto application_thread_sweep = dynamic_cast<Application_Configuration_Thread_Sweep*>(application)) 
 		{
-			std::vector<Vector2> convex_hull;
-			double ellapsed_milliseconds;
-			std::ostringstream detail_info;
+			std::vector<Thread_Sweep_Result> results;
 
-			// Prints algorithm parallelization method
-			if(log_is_verbose || log_is_quiet) 
+			program::log_begin
+				<< "Method: Open MP thread sweep."
+				<< "\nPoints: " << application_thread_sweep->get_point_count() << "."
+				<< program::log_end;
+
+			application_thread_sweep->execute(results);
+
+			for (const auto & result : results)
 			{
 				program::log_begin
-					<< "Method: " << application_computing->get_algorithm_config()->get_info_text() << "."
-					<< "\nPoints: " << application_computing->get_point_count() << "."
+					<< "\t{ threads: " << result.thread_count 
+					<< ", cores: " << result.core_count 
+					<< ", smt: " << (result.is_using_smt ? "on" : "off")
+					<< ", median: " << result.statistics.median << " ms"
+					<< ", speedup: " << result.speedup 
+					<< ", efficiency: " << result.efficiency << " }"
 					<< program::log_end;
 			}
 
-			application_computing->compute_convex_hull(convex_hull, ellapsed_milliseconds, detail_info);
+			const auto & best = results[Application_Configuration_Thread_Sweep::find_best(results)];
+			const auto & knee = results[Application_Configuration_Thread_Sweep::find_knee(results)];
 
-			// Prints number of points
-			if(log_is_verbose || log_is_quiet)
+			program::log_begin
+				<< "Knee: " << knee.thread_count << " threads." 
+				<< "\nBest: " << best.thread_count << " threads (smt: " << (best.is_using_smt ? "on" : "off") << ")."
+				<< program::log_end;
+
+			if (application_thread_sweep->get_is_saving_best()) 
 			{
 				program::log_begin
-					<< "Convex Hull: " << convex_hull.size() << "."
+					<< "Saved: " << program_settings::openmp_threads << " " << best.thread_count 
+					<< " into " << program_settings::filepath << "."
 					<< program::log_end;
 			}
-			else // prints raw number of convex hull points
+		}
+		else
+		if (auto application_shard_worker = dynamic_cast<Application_Configuration_Shard_Worker*>(application)) 
+		{
+			application_shard_worker->execute(); // ..the coordinator reads only the binary result
+		}
+		else
+		if (auto application_sharded = dynamic_cast<Application_Configuration_Sharded*>(application)) 
+		{
+			std::vector<Vector2> convex_hull;
+			std::vector<Shard_Result> shards;
+			double ellapsed_milliseconds;
+
+			if (log_is_verbose || log_is_quiet) 
 			{
-				program::log_begin << convex_hull.size() << program::log_end;
+				program::log_begin
+					<< "Method: Sharded { shards: " << application_sharded->get_shard_count() 
+					<< ", transport: " << application_sharded->get_transport_name() << " }."
+					<< program::log_end;
 			}
 
+			application_sharded->execute(convex_hull, shards, ellapsed_milliseconds);
 
-			size_t convex_hull_hash;
+			long long point_count = 0;
+			for (const auto & shard : shards) point_count += shard.point_count;
 
-			for (int index = 0; index < convex_hull.size(); index++)
+			if (log_is_verbose || log_is_quiet) 
 			{
-				auto &point = convex_hull.at(index);
-				
-				if (log_is_verbose)
+				program::log_begin << "Points: " << point_count << "." << program::log_end;
+			}
+
+			size_t convex_hull_hash = log_convex_hull(convex_hull, this->log_mode);
+
+			if (log_is_verbose || log_is_quiet) 
+			{
+				std::ostringstream detail_info;
+
+				for (int index = 0; index < shards.size(); index++)
 				{
-					program::log_begin 
-						<< "\t{ x: " << point.x << ", y: " << point.y << " }" 
-						<< program::log_end;
+					const auto & shard = shards[index];
+
+					if (index > 0) detail_info << "\n ";
+
+					detail_info 
+						<< "{ shard: " << index 
+						<< ", bytes: " << shard.begin << ".." << shard.end 
+						<< ", points: " << shard.point_count 
+						<< ", hull: " << shard.convex_hull.size() 
+						<< ", worker time: " << shard.milliseconds << " ms" 
+						<< ", attempts: " << shard.attempt_count << " }";
 				}
-				else if(log_is_quiet) 
+
+				program::log_begin
+					<< "Result hash: " << convex_hull_hash << "." 
+					<< "\nAlgorithm time: " << ellapsed_milliseconds << " milliseconds."
+					<< "\nDetails: " << detail_info.str() << "."
+					<< program::log_end;
+			}
+
+			if (application_sharded->get_is_validating()) 
+			{
+				quick_hull::Hull_Validation_Result validation;
+				application_sharded->validate_convex_hull(convex_hull, validation);
+
+				if (!validation.is_valid) 
+				{
+					program::panic_begin 
+						<< "Panic: convex hull validation failed: " << validation.error << "." 
+						<< program::panic_end;
+				}
+
+				if (log_is_verbose || log_is_quiet) 
 				{
-					convex_hull_hash ^= point.get_hash() << 1;
+					program::log_begin << "Validation: passed." << program::log_end;
 				}
-				else // prints a raw point coordinates
+			}
+		}
+		else
+		if (auto application_batch = dynamic_cast<Application_Configuration_Batch*>(application)) 
+		{
+			std::vector<Batch_File_Result> results;
+			double ellapsed_milliseconds;
+
+			if (log_is_verbose || log_is_quiet) 
+			{
+				program::log_begin
+					<< "Method: Batch { files: " << application_batch->get_file_count() 
+					<< ", threads: " << omp_get_max_threads() 
+					<< ", large files: " << application_batch->get_algorithm_config()->get_info_text() << " }."
+					<< "\nKernels: " << quick_hull::get_kernel_isa_name(quick_hull::get_kernels().isa) << "."
+					<< program::log_end;
+			}
+
+			application_batch->execute(results, ellapsed_milliseconds);
+			application_batch->write_results(results);
+
+			int       read_count  = 0;
+			int       large_count = 0;
+			long long point_count = 0;
+
+			for (const auto & result : results)
+			{
+				read_count  += result.is_read;
+				large_count += result.is_large;
+				point_count += result.point_count;
+
+				if (log_is_verbose) 
 				{
 					program::log_begin 
-						<< point.x << " " << point.y 
+						<< "\t{ file: " << result.filepath 
+						<< ", points: " << result.point_count 
+						<< ", hull: " << result.convex_hull.size() 
+						<< ", " << (result.is_large ? "large" : "small") 
+						<< ", " << result.milliseconds << " ms }" 
 						<< program::log_end;
 				}
 			}
 
+			if (log_is_verbose || log_is_quiet) 
+			{
+				double seconds = ellapsed_milliseconds / 1000;
+
+				program::log_begin
+					<< "Files: " << read_count << " of " << results.size() << " read (" << large_count << " large)."
+					<< "\nPoints: " << point_count << "."
+					<< "\nBatch time: " << ellapsed_milliseconds << " milliseconds."
+					<< "\nThroughput: " << (seconds > 0 ? point_count / seconds : 0) << " points/s, " 
+						<< (seconds > 0 ? results.size() / seconds : 0) << " files/s."
+					<< "\nOutput: " << application_batch->get_output_filepath() << "."
+					<< program::log_end;
+			}
+			else // prints raw number of computed files
+			{
+				program::log_begin << read_count << program::log_end;
+			}
+		}
+		else
+		if (auto application_computing = dynamic_cast<Application_Configuration_Computing*>(application)) 
+		{
+			std::vector<Vector2> convex_hull;
+			double ellapsed_milliseconds;
+			std::ostringstream detail_info;
+			Hardware_Counters_Session compute_counters;
+			Hardware_Counters_Session output_counters;
+			bool is_capturing_counters = application_computing->get_is_capturing_counters();
+			Memory_Phase compute_memory;
+			Memory_Phase output_memory;
+			bool is_accounting_memory = is_memory_accounting_enabled();
+
+			// Prints algorithm parallelization method
+			if(log_is_verbose || log_is_quiet) 
+			{
+				program::log_begin
+					<< "Method: " << (application_computing->get_is_computing_layers() ? std::string("Convex layers") : application_computing->get_algorithm_config()->get_info_text()) << "."
+					<< "\nKernels: " << quick_hull::get_kernel_isa_name(quick_hull::get_kernels().isa) << "."
+					<< program::log_end;
+
+				// ..pipelined computing counts the points while reading them
+				if (!application_computing->get_is_pipelined()) 
+				{
+					program::log_begin << "Points: " << application_computing->get_point_count() << "." << program::log_end;
+				}
+			}
+
+			if (is_accounting_memory) compute_memory.begin();
+
+			application_computing->compute_convex_hull(
+				convex_hull, 
+				ellapsed_milliseconds, 
+				detail_info, 
+				is_capturing_counters ? &compute_counters : nullptr
+			);
+
+			if (is_accounting_memory) compute_memory.end();
+
+			if ((log_is_verbose || log_is_quiet) && application_computing->get_is_pipelined()) 
+			{
+				program::log_begin << "Points: " << application_computing->get_point_count() << "." << program::log_end;
+			}
+
+			if (is_accounting_memory) output_memory.begin();
+			if (is_capturing_counters) output_counters.start();
+
+			size_t convex_hull_hash = log_convex_hull(convex_hull, this->log_mode);
+
+			if (is_capturing_counters) output_counters.stop();
+			if (is_accounting_memory) output_memory.end();
+
 			// Prints runtime
 			if (log_is_verbose || log_is_quiet) 
 			{
+				// Appends memory usage of each phase
+				if (is_accounting_memory) 
+				{
+					if (!detail_info.str().empty()) detail_info << "\n ";
+
+					detail_info 
+						<< "{ "
+						<< "\n\t read: { " << application_computing->get_read_memory().get_usage().get_text() << " }"
+						<< "\n\t compute (" << application_computing->get_algorithm_config()->get_info_text() << "): { " << compute_memory.get_usage().get_text() << " }"
+						<< "\n\t output: { " << output_memory.get_usage().get_text() << " }"
+						<< "\n }";
+				}
+
 				auto details = detail_info.str();
 
 				if (details.empty()) 
@@ -171,6 +466,47 @@ namespace program
 					<< "\nDetails: " << details << "."
 					<< program::log_end;
 			}
+
+			// Validates the result (the program fails on an invalid convex hull), a stopped run has no full hull to validate
+			if (application_computing->get_is_validating() && application_computing->get_was_stopped()) 
+			{
+				if (log_is_verbose || log_is_quiet) 
+				{
+					program::log_begin << "Validation: skipped (the computing was stopped)." << program::log_end;
+				}
+			}
+			else
+			if (application_computing->get_is_validating()) 
+			{
+				quick_hull::Hull_Validation_Result validation;
+				double validation_ellapsed_milliseconds;
+
+				application_computing->validate_convex_hull(convex_hull, validation, validation_ellapsed_milliseconds);
+
+				if (!validation.is_valid) 
+				{
+					program::panic_begin 
+						<< "Panic: convex hull validation failed: " << validation.error << "." 
+						<< program::panic_end;
+				}
+
+				if (log_is_verbose || log_is_quiet) 
+				{
+					program::log_begin
+						<< "Validation: passed in " << validation_ellapsed_milliseconds << " milliseconds."
+						<< program::log_end;
+				}
+			}
+
+			// Prints hardware performance counters of each phase
+			if (log_is_verbose && is_capturing_counters) 
+			{
+				program::log_begin
+					<< "Counters (read): " << application_computing->get_read_counters().get_text() << "."
+					<< "\nCounters (compute): " << compute_counters.get_text() << "."
+					<< "\nCounters (output): " << output_counters.get_text() << "."
+					<< program::log_end;
+			}
 		}
 
 
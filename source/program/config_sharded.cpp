@@ -0,0 +1,292 @@
+// standard
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+
+// internal
+#include "io.hpp"
+#include "algorithm/sequential.hpp"
+#include "./constants.hpp"
+#include "./config_sharded.hpp"
+#include "./config_computing.hpp"
+
+namespace program 
+{
+	// Worker output: point count, vertex count, algorithm milliseconds and then the vertices
+	struct Shard_Output_Header 
+	{
+		int64_t point_count;
+		int64_t vertex_count;
+		double  milliseconds;
+	};
+
+
+	static bool try_parse_shard_output(const std::string & output, Shard_Result & result)
+	{
+		Shard_Output_Header header;
+
+		if (output.size() < sizeof(header)) return false;
+
+		std::memcpy(&header, output.data(), sizeof(header));
+
+		if (header.vertex_count < 0 || output.size() != sizeof(header) + header.vertex_count * sizeof(Vector2)) return false;
+
+		result.point_count  = header.point_count;
+		result.milliseconds = header.milliseconds;
+		result.convex_hull.resize(header.vertex_count);
+
+		if (header.vertex_count > 0) std::memcpy(result.convex_hull.data(), output.data() + sizeof(header), header.vertex_count * sizeof(Vector2));
+
+		return true;
+	}
+
+
+	Application_Configuration_Sharded::~Application_Configuration_Sharded()
+	{
+		delete this->transport;
+	}
+
+	Application_Configuration_Sharded::Application_Configuration_Sharded()
+	{
+		this->transport = new Process_Shard_Transport();
+	}
+
+	bool Application_Configuration_Sharded::try_initialize
+	(
+		Input_Configuration input, 
+		bool allow_panic
+	)
+	{
+		this->shard_count = 0;
+		this->is_validating = false;
+		this->worker_arguments.clear();
+
+		// ..the first argument is the program path (workers run their own)
+		bool is_program_path = true;
+
+		for (auto iterator = Input_Configuration_Iterator(input); iterator.move_next(); is_program_path = false) 
+		{
+			if (is_program_path) continue;
+
+			if (iterator.is_argument(program_arguments_tag::shards)) 
+			{
+				if (iterator.move_next()) 
+				{
+					this->shard_count = iterator.get_argument_as_int();
+				}
+				else if (allow_panic) program::panic_begin << "Panic: shard count is missing!" << program::panic_end;
+			}
+			else
+			if (iterator.is_argument(program_arguments_tag::validate)) 
+			{
+				this->is_validating = true;
+			}
+			else
+			if (iterator.is_argument(program_arguments_tag::log_quiet) || iterator.is_argument(program_arguments_tag::log_verbose)) 
+			{
+				// ..workers write only their results
+			}
+			else
+			if (iterator.is_argument(program_arguments_tag::points_filepath)) 
+			{
+				this->worker_arguments.push_back(iterator.get_argument_as_string());
+
+				if (iterator.move_next()) 
+				{
+					this->points_filepath = iterator.get_argument_as_string();
+					this->worker_arguments.push_back(this->points_filepath);
+				}
+				else if (allow_panic) program::panic_begin << "Panic: points filepath is undefined!" << program::panic_end;
+			}
+			else this->worker_arguments.push_back(iterator.get_argument_as_string());
+		}
+
+		if (this->shard_count == 0) return false;
+
+		if (this->shard_count < 0 && allow_panic) 
+		{
+			program::panic_begin << "Panic: shard count must be positive!" << program::panic_end;
+		}
+
+		if (this->points_filepath.empty() && allow_panic) 
+		{
+			program::panic_begin << "Panic: sharded computing requires points filepath!" << program::panic_end;
+		}
+
+		return this->shard_count > 0 && !this->points_filepath.empty();
+	}
+
+	void Application_Configuration_Sharded::execute
+	(
+		std::vector<Vector2>      & result_convex_hull, 
+		std::vector<Shard_Result> & result_shards,
+		double                    & result_ellapsed_milliseconds
+	)
+	{
+		auto stopwatch_start = std::chrono::steady_clock::now();
+
+		size_t body_begin, body_end;
+		get_points_body_range(this->points_filepath, body_begin, body_end);
+
+		// 1. Starts all workers (each reads only its byte range)
+		std::vector<int> handles(this->shard_count);
+		result_shards.resize(this->shard_count);
+
+		auto start_worker = [&](int shard) 
+		{
+			auto arguments = this->worker_arguments;
+			arguments.push_back(program_arguments_tag::shard_range);
+			arguments.push_back(std::to_string(result_shards[shard].begin));
+			arguments.push_back(std::to_string(result_shards[shard].end));
+
+			result_shards[shard].attempt_count++;
+			handles[shard] = this->transport->start(arguments);
+		};
+
+		for (int shard = 0; shard < this->shard_count; shard++)
+		{
+			auto & result = result_shards[shard];
+
+			result.begin         = body_begin + (body_end - body_begin) * shard / this->shard_count;
+			result.end           = body_begin + (body_end - body_begin) * (shard + 1) / this->shard_count;
+			result.attempt_count = 0;
+
+			start_worker(shard);
+		}
+
+		// 2. Collects partial hulls, a failed worker is started once more (other shards are not affected)
+		Point_Buffer partial_hull_points;
+
+		for (int shard = 0; shard < this->shard_count; shard++)
+		{
+			auto & result = result_shards[shard];
+			std::string output;
+
+			bool is_finished = this->transport->finish(handles[shard], output) && try_parse_shard_output(output, result);
+
+			if (!is_finished) 
+			{
+				start_worker(shard);
+				is_finished = this->transport->finish(handles[shard], output) && try_parse_shard_output(output, result);
+			}
+
+			if (!is_finished) 
+			{
+				program::panic_begin 
+					<< "Panic: shard " << shard << " (bytes " << result.begin << ".." << result.end << ") failed " 
+					<< result.attempt_count << " times!" 
+					<< program::panic_end;
+			}
+
+			partial_hull_points.insert(partial_hull_points.end(), result.convex_hull.begin(), result.convex_hull.end());
+		}
+
+		// 3. Merges: the hull of all partial hull vertices is the hull of all points
+		result_convex_hull.clear();
+
+		if (!partial_hull_points.empty()) 
+		{
+			quick_hull::Algorithm_Sequential merge_algorithm;
+
+			auto * convex_hull = merge_algorithm.run(partial_hull_points);
+			result_convex_hull.swap(*convex_hull);
+			delete convex_hull;
+		}
+
+		auto stopwatch_end = std::chrono::steady_clock::now();
+
+		result_ellapsed_milliseconds = std::chrono::duration<double, std::milli>
+		(
+			stopwatch_end - stopwatch_start
+		)
+		.count(); 
+	}
+
+	void Application_Configuration_Sharded::validate_convex_hull
+	(
+		const std::vector<Vector2>         & convex_hull,
+		quick_hull::Hull_Validation_Result & result_validation
+	) 
+	const
+	{
+		Point_Buffer points;
+		read_points(this->points_filepath, points);
+
+		result_validation = quick_hull::validate_convex_hull(convex_hull, points);
+	}
+
+
+	bool Application_Configuration_Shard_Worker::try_initialize
+	(
+		Input_Configuration input, 
+		bool allow_panic
+	)
+	{
+		std::string points_filepath;
+		bool is_there_range = false;
+		bool is_mixed_precision = false;
+		size_t begin = 0, end = 0;
+
+		for (auto iterator = Input_Configuration_Iterator(input); iterator.move_next();) 
+		{
+			if (iterator.is_argument(program_arguments_tag::shard_range)) 
+			{
+				if (iterator.move_next()) begin = iterator.get_argument_as_size();
+				if (iterator.move_next()) end = iterator.get_argument_as_size();
+				else if (allow_panic) program::panic_begin << "Panic: shard range is incomplete!" << program::panic_end;
+
+				is_there_range = true;
+			}
+			else
+			if (iterator.is_argument(program_arguments_tag::mixed_precision)) 
+			{
+				is_mixed_precision = true;
+			}
+			else
+			if (iterator.is_argument(program_arguments_tag::points_filepath)) 
+			{
+				if (iterator.move_next()) points_filepath = iterator.get_argument_as_string();
+			}
+		}
+
+		if (!is_there_range) return false;
+
+		if (points_filepath.empty()) 
+		{
+			if (allow_panic) program::panic_begin << "Panic: shard worker requires points filepath!" << program::panic_end;
+			return false;
+		}
+
+		// ..same order as the computing: pinned threads first touch the points
+		this->algorithm_config = select_algorithm_config(input, is_mixed_precision);
+
+		read_points_range(points_filepath, begin, end, this->points);
+
+		return true;
+	}
+
+	void Application_Configuration_Shard_Worker::execute() const
+	{
+		Shard_Output_Header header { (int64_t)this->points.size(), 0, 0 };
+		std::vector<Vector2> * convex_hull = nullptr;
+
+		if (!this->points.empty()) 
+		{
+			auto stopwatch_start = std::chrono::steady_clock::now();
+
+			convex_hull = this->algorithm_config->get_executor_instance().run(this->points);
+
+			auto stopwatch_end = std::chrono::steady_clock::now();
+
+			header.vertex_count = convex_hull->size();
+			header.milliseconds = std::chrono::duration<double, std::milli>(stopwatch_end - stopwatch_start).count();
+		}
+
+		std::fwrite(&header, sizeof(header), 1, stdout);
+		if (convex_hull != nullptr) std::fwrite(convex_hull->data(), sizeof(Vector2), convex_hull->size(), stdout);
+		std::fflush(stdout);
+
+		delete convex_hull;
+	}
+}
\ No newline at end of file
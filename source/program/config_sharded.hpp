@@ -0,0 +1,81 @@
+#pragma once
+
+// standard
+#include <string>
+#include <vector>
+
+// internal
+#include "core.hpp"
+#include "shard_transport.hpp"
+#include "algorithm/validation.hpp"
+#include "input_configuration.hpp"
+#include "./config_base.hpp"
+#include "./algorithm/config_base.hpp"
+
+namespace program 
+{
+	// Convex hull of the points, which a worker has read from its byte range of the file
+	struct Shard_Result
+	{
+		public: // fields
+			size_t               begin;
+			size_t               end;
+			long long            point_count;
+			double               milliseconds;  // ..algorithm time of the worker
+			int                  attempt_count; // ..a failed worker is started once more
+			std::vector<Vector2> convex_hull;
+	};
+
+
+	// Coordinator: splits the points file into byte ranges, computes the hull of each by a worker process 
+	// and merges the partial hulls (so the points never have to fit into a single address space)
+	struct Application_Configuration_Sharded : public Application_Configuration_Base
+	{
+		private: // ..fields
+			std::string              points_filepath;
+			int                      shard_count;
+			bool                     is_validating;
+			std::vector<std::string> worker_arguments; // ..input forwarded to workers (without coordinator arguments)
+			Shard_Transport        * transport;
+
+		public: // ..getters
+			int get_shard_count() const { return shard_count; }
+			bool get_is_validating() const { return is_validating; }
+			std::string get_transport_name() const { return transport->get_name(); }
+
+		public: // ..constructors & destructors
+			~Application_Configuration_Sharded();
+			Application_Configuration_Sharded();
+
+		public: // ..methods
+			bool try_initialize(Input_Configuration input, bool allow_panic) override;
+
+			void execute
+			(
+				std::vector<Vector2>      & result_convex_hull, 
+				std::vector<Shard_Result> & result_shards,
+				double                    & result_ellapsed_milliseconds
+			);
+
+			// Checks the merged hull against all points of the file (read by the coordinator)
+			void validate_convex_hull
+			(
+				const std::vector<Vector2>         & convex_hull,
+				quick_hull::Hull_Validation_Result & result_validation
+			) const;
+	};
+
+
+	// Worker: computes the hull of the points in a byte range of the file by the selected algorithm,
+	// the result is written into the standard output in binary (read by the coordinator)
+	struct Application_Configuration_Shard_Worker : public Application_Configuration_Base
+	{
+		private: // ..fields
+			Point_Buffer                   points;
+			Algorithm_Configuration_Base * algorithm_config;
+
+		public: // ..methods
+			bool try_initialize(Input_Configuration input, bool allow_panic) override;
+			void execute() const;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,228 @@
+// standard
+#include <chrono>
+#include <algorithm>
+
+// external
+#include "omp.h"
+
+// internal
+#include "io.hpp"
+#include "topology.hpp"
+#include "algorithm/openmp.hpp"
+#include "./constants.hpp"
+#include "./config_thread_sweep.hpp"
+
+namespace program 
+{
+	bool Application_Configuration_Thread_Sweep::try_initialize
+	(
+		Input_Configuration input, 
+		bool allow_panic
+	)
+	{
+		// 1. Looks at input
+
+		bool is_there_sweep_flag = false;
+		std::string points_filepath;
+
+		this->repetition_count = 5;
+		this->is_saving_best = false;
+
+		for (auto iterator = Input_Configuration_Iterator(input); iterator.move_next();) 
+		{
+			if (iterator.is_argument(program_arguments_tag::openmp_sweep)) 
+			{
+				is_there_sweep_flag = true;
+			}
+			else
+			if (iterator.is_argument(program_arguments_tag::openmp_sweep_save)) 
+			{
+				is_there_sweep_flag = true;
+				this->is_saving_best = true;
+			}
+			else
+			if (iterator.is_argument(program_arguments_tag::points_filepath)) 
+			{
+				if (iterator.move_next())
+				{
+					points_filepath = iterator.get_argument_as_string();
+				}
+				else if (allow_panic)
+				{
+					program::panic_begin << "Panic: points filepath is undefined!" << program::panic_end;
+				}
+			}
+		}
+
+		if (!is_there_sweep_flag) 
+		{
+			return false;
+		}
+
+		if (points_filepath.empty()) 
+		{
+			if (allow_panic) program::panic_begin << "Panic: thread sweep requires points filepath!" << program::panic_end;
+			return false;
+		}
+
+
+		// 2. Reads points (only once for all measurements)
+
+		read_points(points_filepath, this->points);
+
+		return true;
+	}
+
+
+	Thread_Sweep_Result Application_Configuration_Thread_Sweep::measure
+	(
+		int thread_count, 
+		const std::vector<int> & cpus
+	) 
+	const
+	{
+		Thread_Sweep_Result result;
+		std::vector<double> samples;
+
+		bind_openmp_threads(cpus, thread_count);
+
+		quick_hull::Algorithm_OpenMP executor(false, thread_count);
+
+		for (int run = 0; run < 1 + repetition_count; run++)
+		{
+			auto stopwatch_start = std::chrono::steady_clock::now();
+
+			delete executor.run(points);
+
+			auto stopwatch_end = std::chrono::steady_clock::now();
+
+			if (run == 0) continue; // ..the first run is a warmup
+
+			samples.push_back(std::chrono::duration<double, std::milli>(stopwatch_end - stopwatch_start).count());
+		}
+
+		result.thread_count = thread_count;
+		result.statistics = compute_measurement_statistics(samples);
+
+		return result;
+	}
+
+
+	void Application_Configuration_Thread_Sweep::execute(std::vector<Thread_Sweep_Result> & results) const
+	{
+		int max_thread_count = omp_get_max_threads();
+
+		auto cores = get_processor_cores();
+		int physical_count = cores.size();
+		int logical_count = 0;
+
+		for (const auto & core : cores) logical_count += core.cpus.size();
+
+		// Collects thread counts: powers of two and the maximum
+		auto get_thread_counts = [](int first, int maximum) 
+		{
+			std::vector<int> counts;
+
+			for (int count = first; count < maximum; count <<= 1) counts.push_back(count);
+			counts.push_back(maximum);
+
+			return counts;
+		};
+
+		// ..cpus of the team threads are restored after the sweep (they may be limited, e.g. by taskset or a cpuset)
+		auto affinities = get_openmp_thread_affinities(std::max(max_thread_count, logical_count));
+
+		// 1. Without SMT: one thread per physical core
+		for (auto thread_count : get_thread_counts(1, physical_count))
+		{
+			std::vector<int> cpus;
+
+			for (int index = 0; index < thread_count; index++) cpus.push_back(cores[index].cpus.front());
+
+			auto result = measure(thread_count, cpus);
+
+			result.core_count = thread_count;
+			result.is_using_smt = false;
+			results.push_back(result);
+		}
+
+		// 2. With SMT: threads fill all logical cpus of a core before using the next one
+		if (logical_count > physical_count)
+		{
+			for (auto thread_count : get_thread_counts(2, logical_count))
+			{
+				std::vector<int> cpus;
+				int core_count = 0;
+
+				for (int core_index = 0; cpus.size() < thread_count; core_index++, core_count++)
+				{
+					for (auto cpu : cores[core_index].cpus) 
+					{
+						if (cpus.size() < thread_count) cpus.push_back(cpu);
+					}
+				}
+
+				auto result = measure(thread_count, cpus);
+
+				result.core_count = core_count;
+				result.is_using_smt = true;
+				results.push_back(result);
+			}
+		}
+
+		// Restores threads binding from before the sweep
+		set_openmp_thread_affinities(affinities);
+
+		// 3. Computes speedup relative to the single thread
+		double single_thread_time = results.front().statistics.median;
+
+		for (auto & result : results)
+		{
+			result.speedup = result.statistics.median > 0 ? single_thread_time / result.statistics.median : 0;
+			result.efficiency = result.speedup / result.thread_count;
+		}
+
+		if (is_saving_best) 
+		{
+			write_setting(
+				program_settings::filepath, 
+				program_settings::openmp_threads, 
+				std::to_string(results[find_best(results)].thread_count)
+			);
+		}
+	}
+
+
+	int Application_Configuration_Thread_Sweep::find_best(const std::vector<Thread_Sweep_Result> & results)
+	{
+		int best_index = 0;
+
+		for (int index = 1; index < results.size(); index++)
+		{
+			if (results[index].statistics.median < results[best_index].statistics.median) best_index = index;
+		}
+
+		return best_index;
+	}
+
+	int Application_Configuration_Thread_Sweep::find_knee(const std::vector<Thread_Sweep_Result> & results)
+	{
+		int knee_index = 0;
+
+		// Results without SMT are sorted by thread count and go first
+		for (int index = 1; index < results.size() && !results[index].is_using_smt; index++)
+		{
+			const auto & previous = results[knee_index];
+			const auto & current = results[index];
+
+			// Speedup gained per added thread
+			double marginal_speedup = (current.speedup - previous.speedup) / (current.thread_count - previous.thread_count);
+
+			if (marginal_speedup < 0.5) break;
+
+			knee_index = index;
+		}
+
+		return knee_index;
+	}
+}
\ No newline at end of file
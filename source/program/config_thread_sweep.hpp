@@ -0,0 +1,52 @@
+#pragma once
+
+// standard
+#include <vector>
+
+// internal
+#include "core.hpp"
+#include "measurement.hpp"
+#include "input_configuration.hpp"
+#include "./config_base.hpp"
+
+namespace program 
+{
+	// Measurement of the Open MP algorithm with one thread count
+	struct Thread_Sweep_Result
+	{
+		public: // fields
+			int                    thread_count;
+			int                    core_count;   // ..physical cores the threads are pinned to
+			bool                   is_using_smt; // ..two threads share each core
+			Measurement_Statistics statistics;
+			double                 speedup;      // ..relative to a single thread
+			double                 efficiency;   // ..speedup per thread
+	};
+
+
+	struct Application_Configuration_Thread_Sweep : public Application_Configuration_Base
+	{
+		private: // ..fields
+			Point_Buffer points;
+			int                  repetition_count;
+			bool                 is_saving_best;
+
+		public: // ..getters
+			int get_point_count() const { return points.size(); }
+			bool get_is_saving_best() const { return is_saving_best; }
+
+		public: // ..methods
+			bool try_initialize(Input_Configuration input, bool allow_panic) override;
+
+			// Measures every thread count (saves the best one when asked)
+			void execute(std::vector<Thread_Sweep_Result> & results) const;
+
+			// Returns index of the fastest result
+			static int find_best(const std::vector<Thread_Sweep_Result> & results);
+			// Returns index of the last result (without SMT) after which adding threads stops paying off
+			static int find_knee(const std::vector<Thread_Sweep_Result> & results);
+
+		private: // ..methods
+			Thread_Sweep_Result measure(int thread_count, const std::vector<int> & cpus) const;
+	};
+}
\ No newline at end of file
@@ -14,6 +14,30 @@ namespace program
 		<< '\t' << program_arguments_tag::points_filepath 
 			<< " [path] \t -> " << program_arguments_definition::points_filepath 
 			<< std::endl
+		<< '\t' << program_arguments_tag::pipelined 
+			<< "\t -> " << program_arguments_definition::pipelined 
+			<< std::endl
+		<< '\t' << program_arguments_tag::deadline 
+			<< " [milliseconds] \t -> " << program_arguments_definition::deadline 
+			<< std::endl
+		<< '\t' << program_arguments_tag::progress 
+			<< "\t -> " << program_arguments_definition::progress 
+			<< std::endl
+		<< '\t' << program_arguments_tag::partial_hull 
+			<< "\t -> " << program_arguments_definition::partial_hull 
+			<< std::endl
+		<< '\t' << program_arguments_tag::convex_layers 
+			<< "\t -> " << program_arguments_definition::convex_layers 
+			<< std::endl
+		<< '\t' << program_arguments_tag::calipers 
+			<< "\t -> " << program_arguments_definition::calipers 
+			<< std::endl
+		<< '\t' << program_arguments_tag::query_file 
+			<< " [path] \t -> " << program_arguments_definition::query_file 
+			<< std::endl
+		<< '\t' << program_arguments_tag::hull_part 
+			<< " [upper|lower|sector (begin) (end)] \t -> " << program_arguments_definition::hull_part 
+			<< std::endl
 			
 		<< '\t' << program_arguments_tag::log_verbose 
 			<< "\t -> " << program_arguments_definition::log_verbose 
@@ -21,6 +45,28 @@ namespace program
 		<< '\t' << program_arguments_tag::log_quiet 
 			<< "\t -> " << program_arguments_definition::log_quiet 
 			<< std::endl
+		<< '\t' << program_arguments_tag::statistics 
+			<< "\t -> " << program_arguments_definition::statistics 
+			<< std::endl
+		<< '\t' << program_arguments_tag::validate 
+			<< "\t -> " << program_arguments_definition::validate 
+			<< std::endl
+		<< '\t' << program_arguments_tag::memory_stats 
+			<< "\t -> " << program_arguments_definition::memory_stats 
+			<< std::endl
+		<< '\t' << program_arguments_tag::perf_counters 
+			<< "\t -> " << program_arguments_definition::perf_counters 
+			<< std::endl
+			
+		<< '\t' << program_arguments_tag::mixed_precision 
+			<< "\t -> " << program_arguments_definition::mixed_precision 
+			<< std::endl
+		<< '\t' << program_arguments_tag::kernel_isa 
+			<< " [sse2|avx2|avx512] \t -> " << program_arguments_definition::kernel_isa 
+			<< std::endl
+		<< '\t' << program_arguments_tag::huge_pages 
+			<< " [transparent|explicit|off] \t -> " << program_arguments_definition::huge_pages 
+			<< std::endl
 			
 		<< '\t' << program_arguments_tag::openmp 
 			<< "\t -> " << program_arguments_definition::openmp 
@@ -28,6 +74,34 @@ namespace program
 		<< '\t' << program_arguments_tag::openmp_threads 
 			<< " [positive interger] \t -> " << program_arguments_definition::opemp_threads 
 			<< std::endl
+		<< '\t' << program_arguments_tag::openmp_trace 
+			<< " [path] \t -> " << program_arguments_definition::openmp_trace 
+			<< std::endl
+		<< '\t' << program_arguments_tag::openmp_pin 
+			<< " [compact|spread|none] \t -> " << program_arguments_definition::openmp_pin 
+			<< std::endl
+		<< '\t' << program_arguments_tag::numa_report 
+			<< "\t -> " << program_arguments_definition::numa_report 
+			<< std::endl
+		<< '\t' << program_arguments_tag::openmp_sweep 
+			<< "\t -> " << program_arguments_definition::openmp_sweep 
+			<< std::endl
+		<< '\t' << program_arguments_tag::openmp_sweep_save 
+			<< "\t -> " << program_arguments_definition::openmp_sweep_save 
+			<< std::endl
+
+		<< '\t' << program_arguments_tag::batch 
+			<< " [directory|glob|manifest] \t -> " << program_arguments_definition::batch 
+			<< std::endl
+		<< '\t' << program_arguments_tag::batch_output 
+			<< " [path] \t -> " << program_arguments_definition::batch_output 
+			<< std::endl
+		<< '\t' << program_arguments_tag::shards 
+			<< " [positive integer] \t -> " << program_arguments_definition::shards 
+			<< std::endl
+		<< '\t' << program_arguments_tag::shard_range 
+			<< " [begin] [end] \t -> " << program_arguments_definition::shard_range 
+			<< std::endl
 			
 		<< '\t' << program_arguments_tag::cuda 
 			<< "\t -> " << program_arguments_definition::cuda 
@@ -53,6 +127,9 @@ namespace program
 		<< "\n\tExamples:"
 		   "\n\t(Seq)    : ./quickhull --file [path] --log-quiet"
 		   "\n\t(Open MP): ./quickhull --file [path] --log-quiet --openmp --openmp-threads 4"
+		   "\n\t(Sweep)  : ./quickhull --file [path] --openmp-sweep --openmp-sweep-save"
+		   "\n\t(Batch)  : ./quickhull --batch \"data/*.txt\" --batch-output hulls.txt --log-quiet --openmp"
+		   "\n\t(Shards) : ./quickhull --file [path] --log-quiet --shards 4 --openmp"
 		   "\n\t(CUDA)   : ./quickhull_cuda --file [path] --log-quiet --cuda --cuda-block-power 3"
 			<< std::endl
 
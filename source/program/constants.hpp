@@ -9,14 +9,48 @@ namespace program_arguments_tag
 
 	// application & points generation
 	static const std::string points_filepath   = "--file";
+	static const std::string pipelined         = "--pipelined";
+
+	// run control
+	static const std::string deadline          = "--deadline";
+	static const std::string progress          = "--progress";
+	static const std::string partial_hull      = "--partial-hull";
+
+	// hull queries
+	static const std::string hull_part         = "--hull-part";
+	static const std::string convex_layers     = "--convex-layers";
+	static const std::string calipers          = "--calipers";
+	static const std::string query_file        = "--query-file";
 
 	// logging
 	static const std::string log_verbose       = "--log-verbose";
 	static const std::string log_quiet         = "--log-quiet";
+	static const std::string statistics        = "--statistics";
+	static const std::string perf_counters     = "--perf-counters";
+	static const std::string validate          = "--validate";
+	static const std::string memory_stats      = "--memory-stats";
+
+	// filtering & kernels
+	static const std::string mixed_precision   = "--mixed-precision";
+	static const std::string kernel_isa        = "--kernel-isa";
+	static const std::string huge_pages        = "--huge-pages";
 
 	// open mp
 	static const std::string openmp            = "--openmp";
 	static const std::string openmp_threads    = "--openmp-threads";
+	static const std::string openmp_trace      = "--openmp-trace";
+	static const std::string openmp_pin        = "--openmp-pin";
+	static const std::string numa_report       = "--numa-report";
+	static const std::string openmp_sweep      = "--openmp-sweep";
+	static const std::string openmp_sweep_save = "--openmp-sweep-save";
+
+	// batch
+	static const std::string batch             = "--batch";
+	static const std::string batch_output      = "--batch-output";
+
+	// sharding
+	static const std::string shards            = "--shards";
+	static const std::string shard_range       = "--shard-range";
 
 	// points generation
 	static const std::string generate_circle   = "--generate-circle";
@@ -32,12 +66,39 @@ namespace program_arguments_definition
 {
 	static const std::string help              = "Prints this information. [] - compulsory, () - optional parameter value.";
 	static const std::string points_filepath   = "Sets points filepath.";
+	static const std::string pipelined         = "Reads the points file in blocks by a reader thread, while the previous blocks are parsed and folded into a running hull (stage waiting is reported in details).";
+
+	static const std::string deadline          = "Stops the computing after the milliseconds (also Ctrl+C stops it), the stop is reported in details and validation is skipped.";
+	static const std::string progress          = "Prints the percent of classified points to the error output (not with pipelined computing).";
+	static const std::string hull_part         = "Computes only a part of the hull: the upper or lower chain, or vertices facing outward directions of a sector (degrees, counter-clockwise from the begin to the end), skipping subproblems, which cannot contribute.";
+	static const std::string convex_layers     = "Peels all convex layers (onion peeling) into the result, layers of a point sample bound the points processed per layer (reported in details).";
+	static const std::string calipers          = "Measures the computed hull by rotating calipers in O(h): diameter, width and the minimum area and perimeter enclosing rectangles (reported in details).";
+	static const std::string query_file        = "Classifies points of the file against the computed hull (the file is mapped, parsed and tested by the threads in SIMD batches), the inside count and throughput are reported in details.";
+	static const std::string partial_hull      = "Keeps the hull vertices found before a stop: a convex polygon of true hull vertices (by default the hull is dropped).";
 
 	static const std::string log_verbose       = "Sets log level: all.";
 	static const std::string log_quiet         = "Sets log level: minimum";
+	static const std::string validate          = "Checks the result to be a strictly convex counter-clockwise hull containing every point (fails the program otherwise).";
+	static const std::string memory_stats      = "Counts allocations and peak heap/resident memory of read, compute and output phases (reported in details).";
+	static const std::string perf_counters     = "Captures hardware performance counters per phase and thread (Linux only, reported in verbose log).";
+	static const std::string statistics        = "Collects per-recursion statistics of the sequential and Open MP algorithms (reported in details).";
+
+	static const std::string kernel_isa        = "Forces kernels of the instruction set: sse2, avx2, avx512 (by default the newest supported by the CPU is detected).";
+	static const std::string huge_pages        = "Backs large point buffers by 2 MB pages: transparent (advised to the kernel) or explicit (reserved pages, transparent when none are free). Reported in details.";
+	static const std::string mixed_precision   = "Filters a float32 copy of the points by an inner octagon first, only the remaining points are computed in double (refined count is reported in details).";
 
 	static const std::string openmp            = "Marks that program will use Open MP version of the Quickhull algorithm.";
-	static const std::string opemp_threads     = "Sets the maximum number of available threads. Should be equal to the amount of physical cores.";
+	static const std::string opemp_threads     = "Sets the maximum number of available threads. By default uses the count saved by the thread sweep or all cores.";
+	static const std::string openmp_pin        = "Pins Open MP threads to cpus: compact (fills a NUMA node first), spread (NUMA nodes in turns) or none. Points are read by the pinned threads.";
+	static const std::string numa_report       = "Reports the root pass of the Open MP version per NUMA node: threads, scanned points, time and share of the scanned pages on the node.";
+	static const std::string openmp_trace      = "Records grow tasks of each thread and writes them as Chrome trace JSON (open in Perfetto).";
+	static const std::string openmp_sweep      = "Runs Open MP version over a range of thread counts (with and without SMT) and reports speedup and efficiency.";
+	static const std::string openmp_sweep_save = "Saves the fastest thread count of the sweep into the settings file used by later runs.";
+
+	static const std::string batch             = "Computes hulls of all files of the directory, the glob pattern or the manifest (one path per line) in a single process.";
+	static const std::string batch_output      = "Sets the file, which gets a summary line and the hull of each batch file (default: batch.out).";
+	static const std::string shards            = "Splits the points file into byte ranges, computes the hull of each by a worker process and merges the partial hulls.";
+	static const std::string shard_range       = "Runs as a shard worker over the byte range of the points file (started by the coordinator), writes the hull in binary.";
 	
 	static const std::string generation_size   = "Sets amount of points to be generated.";
 	static const std::string generate_circle   = "Sets the points generation method: Circle, with outer and inner radius specified.";
@@ -47,6 +108,14 @@ namespace program_arguments_definition
 	static const std::string cuda_thread_power = "Sets order of power of thread number.";
 }
 
+namespace program_settings 
+{
+	// The settings file is looked up in the working directory
+	static const std::string filepath          = "quickhull.config";
+
+	static const std::string openmp_threads    = "openmp-threads";
+}
+
 namespace program 
 {
 	void print_help();
@@ -0,0 +1,118 @@
+// standard
+#include <cerrno>
+#include <climits>
+
+// external
+#if __linux__
+	#include <unistd.h>
+	#include <sys/wait.h>
+#endif
+
+// internal
+#include "shard_transport.hpp"
+
+namespace program
+{
+	// Returns path of this program's executable (workers run the same build)
+	static std::string get_executable_path()
+	{
+#if __linux__
+		char path[PATH_MAX];
+		ssize_t length = readlink("/proc/self/exe", path, sizeof(path) - 1);
+
+		if (length > 0) return std::string(path, length);
+#endif
+		return std::string();
+	}
+
+
+	Process_Shard_Transport::~Process_Shard_Transport()
+	{
+#if __linux__
+		// ..workers, which were not finished, are not left behind
+		for (auto & worker : workers)
+		{
+			if (worker.process_id <= 0) continue;
+
+			close(worker.output_descriptor);
+			waitpid(worker.process_id, nullptr, 0);
+		}
+#endif
+	}
+
+	int Process_Shard_Transport::start(const std::vector<std::string> & arguments)
+	{
+#if __linux__
+		auto executable_path = get_executable_path();
+		if (executable_path.empty()) return -1;
+
+		// ..prepared before the fork, the child only executes
+		std::vector<char *> argument_pointers;
+		argument_pointers.push_back(&executable_path[0]);
+		for (const auto & argument : arguments) argument_pointers.push_back(const_cast<char *>(argument.c_str()));
+		argument_pointers.push_back(nullptr);
+
+		int descriptors[2];
+		if (pipe(descriptors) != 0) return -1;
+
+		int process_id = fork();
+
+		if (process_id < 0) 
+		{
+			close(descriptors[0]);
+			close(descriptors[1]);
+			return -1;
+		}
+
+		// Worker: its standard output goes into the pipe
+		if (process_id == 0) 
+		{
+			close(descriptors[0]);
+			dup2(descriptors[1], STDOUT_FILENO);
+			close(descriptors[1]);
+
+			execv(argument_pointers[0], argument_pointers.data());
+			_exit(127);
+		}
+
+		close(descriptors[1]);
+
+		workers.push_back(Worker_Process { process_id, descriptors[0] });
+		return workers.size() - 1;
+#else
+		return -1;
+#endif
+	}
+
+	bool Process_Shard_Transport::finish(int handle, std::string & result_output)
+	{
+		result_output.clear();
+
+		if (handle < 0 || handle >= workers.size() || workers[handle].process_id <= 0) return false;
+
+#if __linux__
+		auto & worker = workers[handle];
+		char buffer[1 << 16];
+
+		while (true)
+		{
+			ssize_t count = read(worker.output_descriptor, buffer, sizeof(buffer));
+
+			if (count > 0) result_output.append(buffer, count);
+			else if (count < 0 && errno == EINTR) continue;
+			else break;
+		}
+
+		close(worker.output_descriptor);
+
+		int status = 0;
+		waitpid(worker.process_id, &status, 0);
+
+		worker.process_id = 0; // ..finished
+
+		return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+#else
+		return false;
+#endif
+	}
+}
\ No newline at end of file
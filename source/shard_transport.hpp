@@ -0,0 +1,48 @@
+#pragma once
+
+// standard
+#include <string>
+#include <vector>
+
+namespace program
+{
+	// Runs shard workers (this program with worker arguments) and brings their output back to the coordinator.
+	// Workers on other nodes are started by another transport (e.g. over ssh) with the same arguments.
+	struct Shard_Transport
+	{
+		public: // constructors & destructors
+			virtual ~Shard_Transport() { }
+
+		public: // methods
+			virtual std::string get_name() const = 0;
+
+			// Starts the worker, returns its handle (negative when the worker could not start)
+			virtual int start(const std::vector<std::string> & arguments) = 0;
+
+			// Reads the whole output of the worker and waits for it, returns false when the worker failed
+			virtual bool finish(int handle, std::string & result_output) = 0;
+	};
+
+
+	// Local stand-in: forks and executes this program, its standard output comes back through a pipe
+	struct Process_Shard_Transport : public Shard_Transport
+	{
+		private: // types
+			struct Worker_Process 
+			{
+				int process_id;
+				int output_descriptor;
+			};
+
+		private: // fields
+			std::vector<Worker_Process> workers;
+
+		public: // constructors & destructors
+			~Process_Shard_Transport();
+
+		public: // methods
+			std::string get_name() const override { return "process"; }
+			int start(const std::vector<std::string> & arguments) override;
+			bool finish(int handle, std::string & result_output) override;
+	};
+}
\ No newline at end of file
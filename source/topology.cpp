@@ -0,0 +1,354 @@
+// standard
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+
+// external
+#if __linux__
+	#include <sched.h>
+	#include <unistd.h>
+	#include <sys/syscall.h>
+#endif
+
+#if _OPENMP
+	#include "omp.h"
+#endif
+
+// internal
+#include "topology.hpp"
+
+namespace program
+{
+	static bool read_text_file(const std::string & filepath, std::string & result)
+	{
+		std::ifstream input(filepath);
+
+		if (input.fail()) return false;
+
+		std::getline(input, result);
+		return true;
+	}
+
+	static int read_int_file(const std::string & filepath, int fallback)
+	{
+		std::string text;
+
+		if (!read_text_file(filepath, text)) return fallback;
+
+		try { return std::stoi(text); }
+		catch (std::exception exception) { return fallback; }
+	}
+
+
+	std::vector<int> parse_cpu_list(const std::string & text)
+	{
+		std::vector<int> cpus;
+		std::stringstream stream(text);
+		std::string range;
+
+		while (std::getline(stream, range, ','))
+		{
+			if (range.empty()) continue;
+
+			try
+			{
+				auto separator = range.find('-');
+
+				int first = std::stoi(range.substr(0, separator));
+				int last  = separator == std::string::npos ? first : std::stoi(range.substr(separator + 1));
+
+				for (int cpu = first; cpu <= last; cpu++) cpus.push_back(cpu);
+			}
+			catch (std::exception exception) { }
+		}
+
+		return cpus;
+	}
+
+	std::vector<int> get_online_cpus()
+	{
+		std::string text;
+
+		if (read_text_file("/sys/devices/system/cpu/online", text)) 
+		{
+			auto cpus = parse_cpu_list(text);
+			if (!cpus.empty()) return cpus;
+		}
+
+		// ..fallback: cpus numbered by the Open MP runtime
+		std::vector<int> cpus;
+		int count = 1;
+#if _OPENMP
+		count = omp_get_num_procs();
+#endif
+		for (int cpu = 0; cpu < count; cpu++) cpus.push_back(cpu);
+
+		return cpus;
+	}
+
+	std::vector<Processor_Core> get_processor_cores()
+	{
+		std::vector<Processor_Core> cores;
+
+		for (auto cpu : get_online_cpus())
+		{
+			std::string topology = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/";
+
+			int package = read_int_file(topology + "physical_package_id", 0);
+			int core    = read_int_file(topology + "core_id", cpu);
+
+			auto found = std::find_if(cores.begin(), cores.end(), [&](const Processor_Core & other) 
+			{
+				return other.package == package && other.core == core;
+			});
+
+			if (found != cores.end()) 
+			{
+				found->cpus.push_back(cpu);
+			}
+			else 
+			{
+				cores.push_back(Processor_Core { package, core, { cpu } });
+			}
+		}
+
+		return cores;
+	}
+
+	int get_logical_core_count()
+	{
+		return get_online_cpus().size();
+	}
+
+	int get_physical_core_count()
+	{
+		return get_processor_cores().size();
+	}
+
+	std::vector<Numa_Node> get_numa_nodes()
+	{
+		std::vector<Numa_Node> nodes;
+		std::string text;
+
+		if (read_text_file("/sys/devices/system/node/online", text)) 
+		{
+			for (auto node : parse_cpu_list(text)) // ..node lists have the same format
+			{
+				std::string cpu_list;
+
+				if (!read_text_file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist", cpu_list)) continue;
+
+				auto cpus = parse_cpu_list(cpu_list);
+				if (!cpus.empty()) nodes.push_back(Numa_Node { node, cpus });
+			}
+		}
+
+		if (nodes.empty()) nodes.push_back(Numa_Node { 0, get_online_cpus() });
+
+		return nodes;
+	}
+
+	int get_numa_node_of_cpu(const std::vector<Numa_Node> & nodes, int cpu)
+	{
+		for (const auto & node : nodes)
+		{
+			if (std::find(node.cpus.begin(), node.cpus.end(), cpu) != node.cpus.end()) return node.node;
+		}
+
+		return -1;
+	}
+
+	int get_current_cpu()
+	{
+#if __linux__
+		return sched_getcpu();
+#else
+		return -1;
+#endif
+	}
+
+	std::vector<int> get_memory_nodes(const void * begin, size_t size, int sample_count)
+	{
+		std::vector<int> nodes;
+
+#if __linux__ && defined(SYS_move_pages)
+		if (size == 0 || sample_count <= 0) return nodes;
+
+		uintptr_t page_size  = sysconf(_SC_PAGESIZE);
+		uintptr_t first_page = (uintptr_t)begin / page_size;
+		uintptr_t last_page  = ((uintptr_t)begin + size - 1) / page_size;
+		uintptr_t page_count = last_page - first_page + 1;
+
+		sample_count = (int)std::min((uintptr_t)sample_count, page_count);
+
+		std::vector<void *> pages(sample_count);
+		std::vector<int>    status(sample_count);
+
+		for (int index = 0; index < sample_count; index++)
+		{
+			pages[index] = (void *)((first_page + page_count * index / sample_count) * page_size);
+		}
+
+		// ..without target nodes the call only reports where the pages are
+		if (syscall(SYS_move_pages, 0, (unsigned long)sample_count, pages.data(), nullptr, status.data(), 0) != 0) return nodes;
+
+		for (auto node : status) nodes.push_back(node >= 0 ? node : -1);
+#endif
+
+		return nodes;
+	}
+
+	std::vector<int> get_pinning_cpus(Thread_Pinning pinning)
+	{
+		std::vector<int> cpus;
+
+		if (pinning == Thread_Pinning::None) return cpus;
+
+		auto nodes = get_numa_nodes();
+
+		if (pinning == Thread_Pinning::Compact) 
+		{
+			for (const auto & node : nodes) cpus.insert(cpus.end(), node.cpus.begin(), node.cpus.end());
+		}
+		else
+		{
+			for (size_t index = 0, added = 1; added > 0; index++)
+			{
+				added = 0;
+
+				for (const auto & node : nodes)
+				{
+					if (index < node.cpus.size()) 
+					{
+						cpus.push_back(node.cpus[index]);
+						added++;
+					}
+				}
+			}
+		}
+
+		return cpus;
+	}
+
+	bool try_parse_thread_pinning(const std::string & name, Thread_Pinning & result_pinning)
+	{
+		if (name == "none")    { result_pinning = Thread_Pinning::None;    return true; }
+		if (name == "compact") { result_pinning = Thread_Pinning::Compact; return true; }
+		if (name == "spread")  { result_pinning = Thread_Pinning::Spread;  return true; }
+
+		return false;
+	}
+
+	std::string get_thread_pinning_name(Thread_Pinning pinning)
+	{
+		switch (pinning)
+		{
+			case Thread_Pinning::Compact: return "compact";
+			case Thread_Pinning::Spread:  return "spread";
+			default:                      return "none";
+		}
+	}
+
+	bool bind_openmp_threads(const std::vector<int> & cpus, int thread_count)
+	{
+#if __linux__
+		auto allowed_cpus = cpus.empty() ? get_online_cpus() : cpus;
+		std::atomic<bool> is_bound(true); // ..written by every thread of the team
+
+		auto bind_thread = [&](int thread_id) 
+		{
+			cpu_set_t set;
+			CPU_ZERO(&set);
+
+			if (cpus.empty()) 
+			{
+				for (auto cpu : allowed_cpus) CPU_SET(cpu, &set);
+			}
+			else 
+			{
+				CPU_SET(allowed_cpus[thread_id % allowed_cpus.size()], &set);
+			}
+
+			if (sched_setaffinity(0, sizeof(set), &set) != 0) is_bound = false;
+		};
+
+	#if _OPENMP
+		#pragma omp parallel num_threads(thread_count)
+		{
+			bind_thread(omp_get_thread_num());
+		}
+	#else
+		bind_thread(0);
+	#endif
+
+		return is_bound.load();
+#else
+		return false;
+#endif
+	}
+
+	std::vector<std::vector<int>> get_openmp_thread_affinities(int thread_count)
+	{
+		std::vector<std::vector<int>> affinities(thread_count);
+
+#if __linux__
+		auto get_affinity = [&](int thread_id) 
+		{
+			cpu_set_t set;
+			CPU_ZERO(&set);
+
+			if (sched_getaffinity(0, sizeof(set), &set) != 0) return;
+
+			for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) 
+			{
+				if (CPU_ISSET(cpu, &set)) affinities[thread_id].push_back(cpu);
+			}
+		};
+
+	#if _OPENMP
+		#pragma omp parallel num_threads(thread_count)
+		{
+			get_affinity(omp_get_thread_num());
+		}
+	#else
+		get_affinity(0);
+	#endif
+#endif
+
+		return affinities;
+	}
+
+	bool set_openmp_thread_affinities(const std::vector<std::vector<int>> & affinities)
+	{
+#if __linux__
+		std::atomic<bool> is_bound(true); // ..written by every thread of the team
+
+		auto set_affinity = [&](int thread_id) 
+		{
+			if (thread_id >= affinities.size() || affinities[thread_id].empty()) return;
+
+			cpu_set_t set;
+			CPU_ZERO(&set);
+
+			for (auto cpu : affinities[thread_id]) CPU_SET(cpu, &set);
+
+			if (sched_setaffinity(0, sizeof(set), &set) != 0) is_bound = false;
+		};
+
+	#if _OPENMP
+		#pragma omp parallel num_threads(affinities.size())
+		{
+			set_affinity(omp_get_thread_num());
+		}
+	#else
+		set_affinity(0);
+	#endif
+
+		return is_bound.load();
+#else
+		return false;
+#endif
+	}
+}
\ No newline at end of file
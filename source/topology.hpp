@@ -0,0 +1,63 @@
+#pragma once
+
+// standard
+#include <string>
+#include <vector>
+
+namespace program
+{
+	// Physical processor core with its logical cpus (SMT siblings)
+	struct Processor_Core
+	{
+		public: // fields
+			int              package;
+			int              core;
+			std::vector<int> cpus;
+	};
+
+	// Memory node with its logical cpus
+	struct Numa_Node
+	{
+		public: // fields
+			int              node;
+			std::vector<int> cpus;
+	};
+
+	// Order of cpus given to the pinned Open MP threads
+	enum class Thread_Pinning
+	{
+		None,
+		Compact, // ..fills a node before using the next one
+		Spread   // ..threads go to the nodes in turns
+	};
+
+	// Parses a linux cpu list (e.g. "0-3,8,10-11")
+	extern std::vector<int> parse_cpu_list(const std::string & text);
+
+	extern std::vector<int> get_online_cpus();
+	// Returns physical cores (when topology is unknown, each logical cpu is a core)
+	extern std::vector<Processor_Core> get_processor_cores();
+	extern int get_logical_core_count();
+	extern int get_physical_core_count();
+
+	// Returns memory nodes (when topology is unknown, a single node with all online cpus)
+	extern std::vector<Numa_Node> get_numa_nodes();
+	// Returns the node of the cpu (-1 when it is unknown)
+	extern int get_numa_node_of_cpu(const std::vector<Numa_Node> & nodes, int cpu);
+	// Returns the cpu, which runs the calling thread (-1 when it is unknown)
+	extern int get_current_cpu();
+	// Returns nodes of the pages sampled evenly over the memory range (-1 for pages, which are not touched yet),
+	// empty when the kernel does not report page placement
+	extern std::vector<int> get_memory_nodes(const void * begin, size_t size, int sample_count);
+
+	extern std::vector<int> get_pinning_cpus(Thread_Pinning pinning);
+	extern bool try_parse_thread_pinning(const std::string & name, Thread_Pinning & result_pinning);
+	extern std::string get_thread_pinning_name(Thread_Pinning pinning);
+
+	// Pins each thread of the Open MP team to cpus[thread % size], an empty list removes pinning
+	extern bool bind_openmp_threads(const std::vector<int> & cpus, int thread_count);
+	// Returns cpus allowed for each thread of the Open MP team (by thread number, an empty list when it is unknown)
+	extern std::vector<std::vector<int>> get_openmp_thread_affinities(int thread_count);
+	// Restores cpus of each thread of the Open MP team, as returned by get_openmp_thread_affinities
+	extern bool set_openmp_thread_affinities(const std::vector<std::vector<int>> & affinities);
+}
\ No newline at end of file